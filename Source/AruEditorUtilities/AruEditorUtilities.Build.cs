@@ -27,6 +27,7 @@ public class AruEditorUtilities : ModuleRules
 			{
 				"Core",
 				"Blutility",
+				"EditorSubsystem",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -41,6 +42,9 @@ public class AruEditorUtilities : ModuleRules
 				"SlateCore",
 				"GameplayTags", 
 				"MessageLog",
+				"AssetRegistry",
+				"UnrealEd",
+				"SourceControl",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,243 @@
+﻿#include "AruActionProgram.h"
+#include "AruFunctionLibrary.h"
+
+void FAruProgramBuilder::CompareNumeric(const Aru::Numeric::ECompare InCompare, const double InCondition, const bool bInvert)
+{
+	FAruInstruction& Instruction = AddCondition(EAruOpCode::CompareNumeric, bInvert);
+	Instruction.Compare = InCompare;
+	Instruction.Number = InCondition;
+	Instruction.Index = Program.CompareBindings.AddDefaulted();
+}
+
+void FAruProgramBuilder::CompareRange(const double InMin, const double InMax, const bool bInvert)
+{
+	FAruInstruction& Instruction = AddCondition(EAruOpCode::CompareRange, bInvert);
+	Instruction.Number = InMin;
+	Instruction.MaxNumber = InMax;
+	Instruction.Index = Program.RangeBindings.AddDefaulted();
+}
+
+void FAruProgramBuilder::CompareBool(const bool bExpected, const bool bInvert)
+{
+	AddCondition(EAruOpCode::CompareBool, bInvert).Integer = bExpected ? 1 : 0;
+}
+
+void FAruProgramBuilder::CompareObject(const UObject* InObject, const bool bInvert)
+{
+	FAruInstruction& Instruction = AddCondition(EAruOpCode::CompareObject, bInvert);
+	Instruction.Object = InObject;
+	Instruction.Index = Program.ObjectPaths.Emplace(InObject);
+}
+
+void FAruProgramBuilder::SkipIfBoolEqual(const bool InValue)
+{
+	AddGuard(EAruOpCode::JumpIfBoolEqual).Integer = InValue ? 1 : 0;
+}
+
+void FAruProgramBuilder::SkipIfFloatEqual(const float InValue)
+{
+	AddGuard(EAruOpCode::JumpIfFloatEqual).Number = InValue;
+}
+
+void FAruProgramBuilder::SkipIfInt64Equal(const int64 InValue)
+{
+	AddGuard(EAruOpCode::JumpIfInt64Equal).Integer = InValue;
+}
+
+FAruInstruction& FAruProgramBuilder::AddCondition(const EAruOpCode InOp, const bool bInvert)
+{
+	FAruInstruction& Instruction = Program.Conditions.AddDefaulted_GetRef();
+	Instruction.Op = InOp;
+	Instruction.bInvert = bInvert;
+	Instruction.bParameterized = bParameterized;
+	return Instruction;
+}
+
+FAruInstruction& FAruProgramBuilder::AddGuard(const EAruOpCode InOp)
+{
+	// The target is patched once the predicate's call is emitted.
+	FAruInstruction& Instruction = Program.Predicates.AddDefaulted_GetRef();
+	Instruction.Op = InOp;
+	return Instruction;
+}
+
+FAruActionProgram FAruActionProgram::Compile(const FAruActionDefinition& InAction)
+{
+	FAruActionProgram Program;
+	FAruProgramBuilder Builder{Program};
+
+	for (const FAruFilter& Condition : InAction.ForEachCondition())
+	{
+		Builder.bParameterized = Condition.DependsOnParameters();
+		if (!Condition.Lower(Builder))
+		{
+			Builder.AddCondition(EAruOpCode::TestFilter, false).Index = Program.Filters.Add(&Condition);
+		}
+	}
+
+	for (const FAruPredicate& Predicate : InAction.ForEachPredicates())
+	{
+		const int32 FirstGuard = Program.Predicates.Num();
+		Predicate.LowerGuards(Builder);
+
+		FAruInstruction& Call = Program.Predicates.AddDefaulted_GetRef();
+		Call.Op = EAruOpCode::ExecutePredicate;
+		Call.Index = Program.PredicateStructs.Add(&Predicate);
+
+		for (int32 GuardIndex = FirstGuard; GuardIndex < Program.Predicates.Num() - 1; ++GuardIndex)
+		{
+			Program.Predicates[GuardIndex].Target = Program.Predicates.Num();
+		}
+	}
+
+	return Program;
+}
+
+bool FAruActionProgram::AreConditionsMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, const EAruConditionScope InScope) const
+{
+	for (const FAruInstruction& Instruction : Conditions)
+	{
+		if (InScope != EAruConditionScope::All && Instruction.bParameterized != (InScope == EAruConditionScope::Parameterized))
+		{
+			continue;
+		}
+
+		bool bMet = false;
+		switch (Instruction.Op)
+		{
+		case EAruOpCode::CompareNumeric:
+			bMet = CompareNumeric(Instruction, InProperty, InValue);
+			break;
+		case EAruOpCode::CompareRange:
+			bMet = CompareRange(Instruction, InProperty, InValue);
+			break;
+		case EAruOpCode::CompareBool:
+		{
+			const FBoolProperty* BoolProperty = CastField<FBoolProperty>(InProperty);
+			bMet = BoolProperty != nullptr && InValue != nullptr
+				? (BoolProperty->GetPropertyValue(InValue) == (Instruction.Integer != 0)) ^ Instruction.bInvert
+				: Instruction.bInvert;
+			break;
+		}
+		case EAruOpCode::CompareObject:
+			bMet = CompareObject(Instruction, InProperty, InValue);
+			break;
+		case EAruOpCode::TestFilter:
+			bMet = Filters[Instruction.Index]->IsConditionMet(InProperty, InValue, InParameters);
+			break;
+		default:
+			checkNoEntry();
+		}
+
+		if (!bMet)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FAruActionProgram::ExecutePredicates(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	const FFieldClass* FieldClass = InProperty != nullptr && InValue != nullptr ? InProperty->GetClass() : nullptr;
+
+	bool bChanged = false;
+	for (int32 InstructionIndex = 0; InstructionIndex < Predicates.Num(); ++InstructionIndex)
+	{
+		const FAruInstruction& Instruction = Predicates[InstructionIndex];
+		bool bSkip = false;
+		switch (Instruction.Op)
+		{
+		case EAruOpCode::JumpIfBoolEqual:
+			bSkip = FieldClass == FBoolProperty::StaticClass()
+				&& static_cast<const FBoolProperty*>(InProperty)->GetPropertyValue(InValue) == (Instruction.Integer != 0);
+			break;
+		case EAruOpCode::JumpIfFloatEqual:
+			bSkip = FieldClass == FFloatProperty::StaticClass()
+				&& *static_cast<const float*>(InValue) == static_cast<float>(Instruction.Number);
+			break;
+		case EAruOpCode::JumpIfInt64Equal:
+			bSkip = FieldClass == FInt64Property::StaticClass()
+				&& *static_cast<const int64*>(InValue) == Instruction.Integer;
+			break;
+		case EAruOpCode::ExecutePredicate:
+			bChanged |= PredicateStructs[Instruction.Index]->Execute(InProperty, InValue, InParameters);
+			break;
+		default:
+			checkNoEntry();
+		}
+
+		if (bSkip)
+		{
+			// The loop increment lands on the instruction right after the predicate's call.
+			InstructionIndex = Instruction.Target - 1;
+		}
+	}
+	return bChanged;
+}
+
+bool FAruActionProgram::CompareNumeric(const FAruInstruction& InInstruction, const FProperty* InProperty, const void* InValue) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return InInstruction.bInvert;
+	}
+
+	Aru::Numeric::FCompareBinding& Binding = CompareBindings[InInstruction.Index];
+	const FFieldClass* FieldClass = InProperty->GetClass();
+	if (FieldClass != Binding.FieldClass)
+	{
+		Aru::Numeric::Bind(FieldClass, InInstruction.Compare, InInstruction.Number, Binding);
+	}
+
+	if (Binding.Kernel == nullptr)
+	{
+		return InInstruction.bInvert;
+	}
+
+	return Binding.Kernel(InValue, Binding.Operand) ^ InInstruction.bInvert;
+}
+
+bool FAruActionProgram::CompareRange(const FAruInstruction& InInstruction, const FProperty* InProperty, const void* InValue) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return InInstruction.bInvert;
+	}
+
+	Aru::Numeric::FRangeBinding& Binding = RangeBindings[InInstruction.Index];
+	const FFieldClass* FieldClass = InProperty->GetClass();
+	if (FieldClass != Binding.FieldClass)
+	{
+		Aru::Numeric::Bind(FieldClass, InInstruction.Number, InInstruction.MaxNumber, Binding);
+	}
+
+	if (Binding.Kernel == nullptr)
+	{
+		return InInstruction.bInvert;
+	}
+
+	return Binding.Kernel(InValue, Binding.Min, Binding.Max) ^ InInstruction.bInvert;
+}
+
+bool FAruActionProgram::CompareObject(const FAruInstruction& InInstruction, const FProperty* InProperty, const void* InValue) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return InInstruction.bInvert;
+	}
+
+	if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty))
+	{
+		return (ObjectProperty->GetObjectPropertyValue(InValue) == InInstruction.Object) ^ InInstruction.bInvert;
+	}
+
+	// Soft references are compared by path and never loaded.
+	FSoftObjectPath ReferencedPath;
+	if (!UAruFunctionLibrary::GetReferencedPath(InProperty, InValue, ReferencedPath))
+	{
+		return InInstruction.bInvert;
+	}
+
+	return (ReferencedPath == ObjectPaths[InInstruction.Index]) ^ InInstruction.bInvert;
+}
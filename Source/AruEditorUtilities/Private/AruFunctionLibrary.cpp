@@ -1,12 +1,74 @@
 #include "AruFunctionLibrary.h"
+#include "AruPropertyTraversal.h"
 #include "AruTypes.h"
+#include "Algo/AnyOf.h"
 #include "EditorUtilityLibrary.h"
-#include "GameplayTagContainer.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "ScopedTransaction.h"
 #include "StructUtils/InstancedStruct.h"
+#include "UObject/SavePackage.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruFunctionLibrary)
 
 #define LOCTEXT_NAMESPACE "AruEditorUtilities"
 
+FAruActionBuckets::FAruActionBuckets(TArray<FAruActionSource>&& InSources, const bool bCompileActions)
+	: Sources(MoveTemp(InSources))
+{
+	TSet<const FAruActionDefinition*> SeenActions;
+	for (const FAruActionSource& Source : Sources)
+	{
+		MaxSearchDepth = FMath::Max(MaxSearchDepth, Source.MaxSearchDepth);
+		for (const FAruActionDefinition& Action : Source.Actions)
+		{
+			bool bAlreadySeen = false;
+			SeenActions.Add(&Action, &bAlreadySeen);
+			if (bAlreadySeen)
+			{
+				SharedActions.Add(&Action);
+			}
+			else if (bCompileActions)
+			{
+				Programs.Add(&Action, FAruActionProgram::Compile(Action));
+			}
+		}
+	}
+}
+
+TConstArrayView<FAruBoundAction> FAruActionBuckets::Find(const FProperty* InProperty)
+{
+	if (InProperty == nullptr)
+	{
+		return {};
+	}
+
+	const UScriptStruct* StructType = nullptr;
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+	{
+		StructType = StructProperty->Struct;
+	}
+
+	const FBucketKey BucketKey{InProperty->GetClass(), StructType};
+	if (const TArray<FAruBoundAction>* Bucket = Buckets.Find(BucketKey))
+	{
+		return *Bucket;
+	}
+
+	TArray<FAruBoundAction>& NewBucket = Buckets.Add(BucketKey);
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+	{
+		const FAruActionSource& Source = Sources[SourceIndex];
+		for (const FAruActionDefinition& Action : Source.Actions)
+		{
+			if (Action.CanApplyTo(BucketKey.Key, BucketKey.Value))
+			{
+				NewBucket.Add({&Action, Source.Parameters, MaxSearchDepth - Source.MaxSearchDepth, SourceIndex, SharedActions.Contains(&Action), Programs.Find(&Action)});
+			}
+		}
+	}
+	return NewBucket;
+}
+
 void UAruFunctionLibrary::ProcessSelectedAssets(const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs)
 {
 	const TArray<UObject*>&& SelectedObjects = UEditorUtilityLibrary::GetSelectedAssets();
@@ -14,15 +76,107 @@ void UAruFunctionLibrary::ProcessSelectedAssets(const TArray<FAruActionDefinitio
 }
 
 bool UAruFunctionLibrary::ProcessAssets(const TArray<UObject*>& Objects, const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs)
+{
+	BeginProcessing(Actions, Configs);
+
+	FAruProcessingState State{Actions, Configs};
+	if (!State.bValidPropertyQuery)
+	{
+		return false;
+	}
+
+	return ProcessAssetsInternal(Objects, Configs, State);
+}
+
+bool UAruFunctionLibrary::ProcessAssetsWithConfigs(const TArray<UObject*>& Objects, const TArray<FAruActionConfigRun>& ConfigRuns, const FAruProcessConfig& Configs)
+{
+	// The traversal goes as deep as the deepest config, actions of shallower ones skip what lies beyond their own depth.
+	FAruProcessConfig FusedConfigs = Configs;
+	FusedConfigs.MaxSearchDepth = 0;
+
+	TArray<FAruActionSource> Sources;
+	for (const FAruActionConfigRun& ConfigRun : ConfigRuns)
+	{
+		if (ConfigRun.ConfigData == nullptr)
+		{
+			continue;
+		}
+
+		for (const FAruActionDefinition& Action : ConfigRun.ConfigData->ActionDefinitions)
+		{
+			Action.BeginProcessing(ConfigRun.Parameters);
+		}
+		Sources.Add({ConfigRun.ConfigData->ActionDefinitions, &ConfigRun.Parameters, ConfigRun.MaxSearchDepth, ConfigRun.ConfigData->GetName()});
+		FusedConfigs.MaxSearchDepth = FMath::Max(FusedConfigs.MaxSearchDepth, ConfigRun.MaxSearchDepth);
+	}
+
+	if (Sources.IsEmpty())
+	{
+		return false;
+	}
+
+	FAruProcessingState State{MoveTemp(Sources), FusedConfigs};
+	if (!State.bValidPropertyQuery)
+	{
+		return false;
+	}
+
+	return ProcessAssetsInternal(Objects, FusedConfigs, State);
+}
+
+bool UAruFunctionLibrary::ProcessAssetsInternal(const TArray<UObject*>& Objects, const FAruProcessConfig& Configs, FAruProcessingState& State)
 {
 	FScopedSlowTask Progress(Objects.Num(), LOCTEXT("Processing...", "Processing..."));
 	Progress.MakeDialog();
 
 	bool Result = false;
-	for (auto& Object : Objects)
+	// Closed before saving, Modify calls made by PreSave or source control checkouts don't belong in the run's undo entry.
 	{
-		Progress.EnterProgressFrame(1.f);
-		Result |= ProcessAsset(Object, Actions, Configs);
+		FScopedTransaction Transaction{LOCTEXT("ProcessAssetsTransaction", "Process Assets"), Configs.bUndoable};
+		int32 NumChangedAssets = 0;
+		for (auto& Object : Objects)
+		{
+			Progress.EnterProgressFrame(1.f);
+			const bool bAssetChanged = ProcessAssetInternal(Object, Configs, State);
+			NumChangedAssets += bAssetChanged ? 1 : 0;
+			Result |= bAssetChanged;
+		}
+
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+			FText::Format(
+				LOCTEXT(
+					"ProcessAssetsSummary",
+					"[{0}]{1} of {2} assets changed, {3} value(s) in total."),
+				FText::FromString(Aru::ProcessResult::Success),
+				FText::AsNumber(NumChangedAssets),
+				FText::AsNumber(Objects.Num()),
+				FText::AsNumber(State.GetNumChanges())
+			));
+
+		const TConstArrayView<FAruActionSource> Sources = State.ActionBuckets.GetSources();
+		for (int32 SourceIndex = 0; Sources.Num() > 1 && SourceIndex < Sources.Num(); ++SourceIndex)
+		{
+			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+				FText::Format(
+					LOCTEXT(
+						"ProcessAssetsSourceSummary",
+						"[{0}]'{1}' changed {2} value(s)."),
+					FText::FromString(Aru::ProcessResult::Success),
+					FText::FromString(Sources[SourceIndex].Label),
+					FText::AsNumber(State.GetNumChanges(SourceIndex))
+				));
+		}
+
+		// Reruns that change nothing leave neither dirty packages nor an undo entry behind.
+		if (!State.FinishModifications())
+		{
+			Transaction.Cancel();
+		}
+	}
+
+	if (Configs.bSaveModifiedPackages)
+	{
+		SavePackages(State.GetModifiedPackages(), Configs.bCheckOutModifiedPackages, Configs.SaveBatchSize);
 	}
 
 	return Result;
@@ -30,193 +184,533 @@ bool UAruFunctionLibrary::ProcessAssets(const TArray<UObject*>& Objects, const T
 
 bool UAruFunctionLibrary::ProcessAsset(UObject* const Object, const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs)
 {
-	UObject* ObjectToProcess = Object;
-	UClass* ClassToProcess = Object->GetClass();
-	if (UBlueprint* BlueprintAsset = Cast<UBlueprint>(Object))
+	BeginProcessing(Actions, Configs);
+
+	FAruProcessingState State{Actions, Configs};
+	if (!State.bValidPropertyQuery)
 	{
-		ClassToProcess = BlueprintAsset->GeneratedClass;
-		ObjectToProcess = ClassToProcess->GetDefaultObject();
+		return false;
 	}
 
 	bool bExecutedSuccessfully = false;
-	for (TFieldIterator<FProperty> It{ClassToProcess}; It; ++It)
 	{
-		FProperty* Property = *It;
-		if (Property == nullptr)
+		FScopedTransaction Transaction{LOCTEXT("ProcessAssetTransaction", "Process Asset"), Configs.bUndoable};
+		bExecutedSuccessfully = ProcessAssetInternal(Object, Configs, State);
+
+		if (!State.FinishModifications())
 		{
-			continue;
+			Transaction.Cancel();
 		}
-		void* ValuePtr = Property->ContainerPtrToValuePtr<void>(ObjectToProcess);
-		if (ValuePtr == nullptr)
+	}
+
+	if (Configs.bSaveModifiedPackages)
+	{
+		SavePackages(State.GetModifiedPackages(), Configs.bCheckOutModifiedPackages, Configs.SaveBatchSize);
+	}
+
+	return bExecutedSuccessfully;
+}
+
+int32 UAruFunctionLibrary::SavePackages(const TArray<UPackage*>& InPackages, const bool bCheckOut, const int32 InBatchSize)
+{
+	TArray<UPackage*> PackagesToSave = InPackages.FilterByPredicate([](const UPackage* Package)
+	{
+		return Package != nullptr && Package->IsDirty() && !Package->HasAnyPackageFlags(PKG_CompiledIn);
+	});
+
+	if (PackagesToSave.IsEmpty())
+	{
+		return 0;
+	}
+
+	if (bCheckOut && ISourceControlModule::Get().IsEnabled())
+	{
+		// One operation for every package, checking them out one by one costs a server round trip each.
+		FEditorFileUtils::CheckoutPackages(PackagesToSave, nullptr, false);
+	}
+
+	FScopedSlowTask Progress(PackagesToSave.Num(), LOCTEXT("SavingPackages", "Saving modified packages..."));
+	Progress.MakeDialog();
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_Async;
+	SaveArgs.Error = GWarn;
+
+	const int32 BatchSize = FMath::Max(InBatchSize, 1);
+	int32 NumSaved = 0;
+	for (int32 Index = 0; Index < PackagesToSave.Num(); ++Index)
+	{
+		UPackage* Package = PackagesToSave[Index];
+		Progress.EnterProgressFrame(1.f);
+
+		const FString& Extension = Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension();
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), Extension);
+		if (UPackage::SavePackage(Package, nullptr, *Filename, SaveArgs))
 		{
-			continue;
+			++NumSaved;
+		}
+		else
+		{
+			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+				FText::Format(
+					LOCTEXT(
+						"SavePackageFailed",
+						"[{0}]Failed to save package:'{1}'."),
+					FText::FromString(Aru::ProcessResult::Failed),
+					FText::FromString(Package->GetName())
+				));
 		}
 
-		bExecutedSuccessfully |= ProcessContainerValues(Property, ValuePtr, {Actions, Configs.Parameters, Configs.MaxSearchDepth});
+		// Serialization moves on while earlier packages are written, waiting per batch bounds the memory held by pending writes.
+		if ((Index + 1) % BatchSize == 0)
+		{
+			UPackage::WaitForAsyncFileWrites();
+		}
 	}
+	UPackage::WaitForAsyncFileWrites();
+
+	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+		FText::Format(
+			LOCTEXT(
+				"SavedPackages",
+				"[{0}]Saved {1} of {2} modified packages."),
+			FText::FromString(Aru::ProcessResult::Success),
+			FText::AsNumber(NumSaved),
+			FText::AsNumber(PackagesToSave.Num())
+		));
+
+	return NumSaved;
+}
 
-	if (bExecutedSuccessfully)
+void UAruFunctionLibrary::BeginProcessing(const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs)
+{
+	for (const auto& Action : Actions)
 	{
-		Object->Modify();
+		Action.BeginProcessing(Configs.Parameters);
 	}
-
-	return bExecutedSuccessfully;
 }
 
-bool UAruFunctionLibrary::ProcessContainerValues(
-	FProperty* PropertyPtr,
-	void* ValuePtr,
-	const FAruProcessingParameters& InParameters)
+bool UAruFunctionLibrary::ProcessAssetInternal(
+	UObject* const Object,
+	const FAruProcessConfig& Configs,
+	FAruProcessingState& State)
 {
-	if (InParameters.RemainTime <= 0 || PropertyPtr == nullptr || ValuePtr == nullptr)
+	if (Object == nullptr)
 	{
 		return false;
 	}
 
-	bool bExecutedSuccessfully = false;
-	if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(PropertyPtr))
+	UObject* ObjectToProcess = Object;
+	UClass* ClassToProcess = Object->GetClass();
+	if (UBlueprint* BlueprintAsset = Cast<UBlueprint>(Object))
+	{
+		ClassToProcess = BlueprintAsset->GeneratedClass;
+		ObjectToProcess = ClassToProcess->GetDefaultObject();
+	}
+
+	State.RootObject = ObjectToProcess;
+	if (!State.MarkVisited(ObjectToProcess, Configs.MaxSearchDepth, {}, State.PropertyQuery.GetInitialStates()))
+	{
+		return false;
+	}
+
+	const int32 NumChangesBefore = State.GetNumChanges();
+
+	FAruPropertyTraversal Traversal{State};
+	Traversal.AddProperties(ClassToProcess, ObjectToProcess, Configs.MaxSearchDepth);
+	Traversal.Run();
+
+	const int32 NumAssetChanges = State.GetNumChanges() - NumChangesBefore;
+	if (NumAssetChanges > 0)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+			FText::Format(
+				LOCTEXT(
+					"ProcessAssetChanged",
+					"[{0}]Asset:'{1}' {2} value(s) changed."),
+				FText::FromString(Aru::ProcessResult::Success),
+				FText::FromString(Object->GetPathName()),
+				FText::AsNumber(NumAssetChanges)
+			));
+	}
+
+	return Traversal.HasExecuted();
+}
+
+namespace Aru::Memo
+{
+	static uint32 HashStruct(const UScriptStruct* InStructType, const void* InValue);
+
+	static uint32 HashSingleValue(const FProperty* InProperty, const void* InValue)
 	{
-		[&]
+		if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
 		{
-			UObject* NativeObject = ObjectProperty->GetObjectPropertyValue(ValuePtr);
-			if (NativeObject == nullptr)
+			if (StructProperty->Struct == FInstancedStruct::StaticStruct())
 			{
-				return;
+				const FInstancedStruct* InstancedStruct = static_cast<const FInstancedStruct*>(InValue);
+				const UScriptStruct* PayloadType = InstancedStruct->GetScriptStruct();
+				const uint32 TypeHash = GetTypeHash(PayloadType);
+				return PayloadType != nullptr ? HashCombineFast(TypeHash, HashStruct(PayloadType, InstancedStruct->GetMemory())) : TypeHash;
 			}
+			return HashStruct(StructProperty->Struct, InValue);
+		}
+
+		if (InProperty->HasAnyPropertyFlags(CPF_HasGetValueTypeHash))
+		{
+			return InProperty->GetValueTypeHash(InValue);
+		}
 
-			UClass* NativeClass = NativeObject->GetClass();
-			if (NativeClass == nullptr)
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(InProperty))
+		{
+			FScriptArrayHelper ArrayHelper{ArrayProperty, InValue};
+			uint32 Hash = GetTypeHash(ArrayHelper.Num());
+			for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
 			{
-				return;
+				Hash = HashCombineFast(Hash, FAruConditionMemo::HashValue(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index)));
 			}
+			return Hash;
+		}
 
-			if (UBlueprint* BlueprintAsset = Cast<UBlueprint>(NativeObject))
+		if (const FSetProperty* SetProperty = CastField<FSetProperty>(InProperty))
+		{
+			FScriptSetHelper SetHelper{SetProperty, InValue};
+			uint32 Hash = GetTypeHash(SetHelper.Num());
+			for (FScriptSetHelper::FIterator It{SetHelper}; It; ++It)
 			{
-				NativeClass = BlueprintAsset->GeneratedClass;
-				NativeObject = NativeClass->GetDefaultObject();
+				Hash = HashCombineFast(Hash, FAruConditionMemo::HashValue(SetProperty->ElementProp, SetHelper.GetElementPtr(It.GetInternalIndex())));
 			}
+			return Hash;
+		}
 
-			for (TFieldIterator<FProperty> It{NativeClass}; It; ++It)
+		if (const FMapProperty* MapProperty = CastField<FMapProperty>(InProperty))
+		{
+			FScriptMapHelper MapHelper{MapProperty, InValue};
+			uint32 Hash = GetTypeHash(MapHelper.Num());
+			for (FScriptMapHelper::FIterator It{MapHelper}; It; ++It)
 			{
-				FProperty* Property = *It;
-				if (Property == nullptr)
-				{
-					continue;
-				}
-				void* ObjectValuePtr = Property->ContainerPtrToValuePtr<void>(NativeObject);
-				if (ValuePtr == nullptr)
-				{
-					continue;
-				}
-				bExecutedSuccessfully |= ProcessContainerValues(Property, ObjectValuePtr, InParameters.GetSubsequentParameters());
+				Hash = HashCombineFast(Hash, FAruConditionMemo::HashValue(MapProperty->KeyProp, MapHelper.GetKeyPtr(It.GetInternalIndex())));
+				Hash = HashCombineFast(Hash, FAruConditionMemo::HashValue(MapProperty->ValueProp, MapHelper.GetValuePtr(It.GetInternalIndex())));
 			}
-		}();
+			return Hash;
+		}
+
+		if (const FTextProperty* TextProperty = CastField<FTextProperty>(InProperty))
+		{
+			return GetTypeHash(TextProperty->GetPropertyValue(InValue).ToString());
+		}
+
+		// Anything without a cheaper hash, identical values export the same text.
+		FString ValueText;
+		InProperty->ExportTextItem_Direct(ValueText, InValue, nullptr, nullptr, PPF_None);
+		return GetTypeHash(ValueText);
 	}
-	else if (FStructProperty* StructProperty = CastField<FStructProperty>(PropertyPtr))
+
+	static uint32 HashStruct(const UScriptStruct* InStructType, const void* InValue)
 	{
-		[&]
+		if (InStructType->GetCppStructOps() != nullptr && InStructType->GetCppStructOps()->HasGetTypeHash())
 		{
-			const UScriptStruct* StructType = StructProperty->Struct;
-			if (StructType == nullptr)
-			{
-				return;
-			}
+			return InStructType->GetStructTypeHash(InValue);
+		}
 
-			if (StructType == FGameplayTag::StaticStruct()
-				|| StructType == FGameplayTagQuery::StaticStruct()
-				|| StructType == FGameplayTagContainer::StaticStruct())
-			{
-				return;
-			}
+		uint32 Hash = GetTypeHash(InStructType);
+		for (TFieldIterator<FProperty> It{InStructType}; It; ++It)
+		{
+			Hash = HashCombineFast(Hash, FAruConditionMemo::HashValue(*It, It->ContainerPtrToValuePtr<void>(InValue)));
+		}
+		return Hash;
+	}
+}
 
-			if (StructType == FInstancedStruct::StaticStruct())
-			{
-				FInstancedStruct* InstancedStructPtr = static_cast<FInstancedStruct*>(ValuePtr);
-				if (InstancedStructPtr == nullptr || !InstancedStructPtr->IsValid())
-				{
-					return;
-				}
-				const UScriptStruct* InstancedStructType = InstancedStructPtr->GetScriptStruct();
-				if (InstancedStructType == nullptr)
-				{
-					return;
-				}
-				void* InstancedStructContainer = InstancedStructPtr->GetMutableMemory();
-				if (InstancedStructContainer == nullptr)
-				{
-					return;
-				}
+TOptional<bool> FAruConditionMemo::Find(
+	const FAruBoundAction& InAction,
+	const FStructProperty* InProperty,
+	const void* InValue,
+	const uint32 InValueHash) const
+{
+	const TArray<FMemoEntry, TInlineAllocator<1>>* Candidates = Entries.Find(FMemoKey{InAction.Action, InAction.Parameters, InProperty, InValueHash});
+	if (Candidates == nullptr)
+	{
+		return {};
+	}
 
-				for (TFieldIterator<FProperty> It{InstancedStructType}; It; ++It)
-				{
-					FProperty* Property = *It;
-					if (Property == nullptr)
-					{
-						continue;
-					}
-					void* StructValuePtr = Property->ContainerPtrToValuePtr<void>(InstancedStructContainer);
-					if (ValuePtr == nullptr)
-					{
-						continue;
-					}
-					bExecutedSuccessfully |= ProcessContainerValues(Property, StructValuePtr, InParameters.GetSubsequentParameters());
-				}
-			}
-			else
-			{
-				for (TFieldIterator<FProperty> It{StructType}; It; ++It)
-				{
-					FProperty* Property = *It;
-					if (Property == nullptr)
-					{
-						continue;
-					}
-					void* StructValuePtr = Property->ContainerPtrToValuePtr<void>(ValuePtr);
-					if (ValuePtr == nullptr)
-					{
-						continue;
-					}
-					bExecutedSuccessfully |= ProcessContainerValues(Property, StructValuePtr, InParameters.GetSubsequentParameters());
-				}
-			}
-		}();
+	for (const FMemoEntry& Candidate : *Candidates)
+	{
+		if (InProperty->Struct->CompareScriptStruct(Candidate.Value.GetMemory(), InValue, PPF_None))
+		{
+			return Candidate.bConditionsMet;
+		}
+	}
+	return {};
+}
+
+void FAruConditionMemo::Add(
+	const FAruBoundAction& InAction,
+	const FStructProperty* InProperty,
+	const void* InValue,
+	const uint32 InValueHash,
+	const bool bConditionsMet)
+{
+	FMemoEntry& Entry = Entries.FindOrAdd(FMemoKey{InAction.Action, InAction.Parameters, InProperty, InValueHash}).AddDefaulted_GetRef();
+	Entry.Value.InitializeAs(InProperty->Struct, static_cast<const uint8*>(InValue));
+	Entry.bConditionsMet = bConditionsMet;
+}
+
+uint32 FAruConditionMemo::HashValue(const FProperty* InProperty, const void* InValue)
+{
+	uint32 Hash = 0;
+	for (int32 Index = 0; Index < InProperty->GetArrayDim(); ++Index)
+	{
+		Hash = HashCombineFast(Hash, Aru::Memo::HashSingleValue(InProperty, static_cast<const uint8*>(InValue) + Index * InProperty->GetElementSize()));
 	}
-	else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(PropertyPtr))
+	return Hash;
+}
+
+FAruTraversalDepth FAruTraversalDepth::Step(const EAruTraversalStep InStep) const
+{
+	FAruTraversalDepth SubsequentDepth = *this;
+	switch (InStep)
+	{
+	case EAruTraversalStep::Object: ++SubsequentDepth.ObjectHops; break;
+	case EAruTraversalStep::Struct: ++SubsequentDepth.StructNesting; break;
+	case EAruTraversalStep::Container: ++SubsequentDepth.ContainerNesting; break;
+	}
+	return SubsequentDepth;
+}
+
+namespace Aru::Processing
+{
+	static TArray<FAruActionSource> MakeActionSources(const TArray<FAruActionDefinition>& InActions, const FAruProcessConfig& InConfig)
 	{
-		FScriptArrayHelper ArrayHelper{ArrayProperty, ValuePtr};
-		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+		if (InConfig.ParameterMatrix.IsEmpty())
 		{
-			void* ItemPtr = ArrayHelper.GetRawPtr(Index);
-			bExecutedSuccessfully |= ProcessContainerValues(ArrayProperty->Inner, ItemPtr, InParameters.GetSubsequentParameters());
+			return {FAruActionSource{InActions, &InConfig.Parameters, InConfig.MaxSearchDepth}};
 		}
+
+		TArray<FAruActionSource> Sources;
+		for (int32 Index = 0; Index < InConfig.ParameterMatrix.Num(); ++Index)
+		{
+			Sources.Add({InActions, &InConfig.ParameterMatrix[Index], InConfig.MaxSearchDepth, FString::Printf(TEXT("ParameterMatrix[%d]"), Index)});
+		}
+		return Sources;
 	}
-	else if (FMapProperty* MapProperty = CastField<FMapProperty>(PropertyPtr))
+}
+
+FAruProcessingState::FAruProcessingState(const TArray<FAruActionDefinition>& InActions, const FAruProcessConfig& InConfig)
+	: FAruProcessingState(Aru::Processing::MakeActionSources(InActions, InConfig), InConfig)
+{
+}
+
+FAruProcessingState::FAruProcessingState(TArray<FAruActionSource>&& InSources, const FAruProcessConfig& InConfig)
+	: ActionBuckets(MoveTemp(InSources), InConfig.bCompileActions), Config(InConfig)
+{
+	const FString&& ResolvedQuery = UAruFunctionLibrary::ResolveParameterizedString(InConfig.Parameters, InConfig.PropertyQuery);
+	TOptional<FAruPropertyQuery> CompiledQuery = FAruPropertyQuery::Compile(ResolvedQuery);
+	if (!CompiledQuery.IsSet())
 	{
-		FScriptMapHelper MapHelper{MapProperty, ValuePtr};
-		for (int32 Index = 0; Index < MapHelper.Num(); ++Index)
+		bValidPropertyQuery = false;
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Error(
+			FText::Format(
+				LOCTEXT(
+					"InvalidPropertyQuery",
+					"Invalid property query:'{0}', nothing was processed."),
+				FText::FromString(ResolvedQuery)
+			));
+		return;
+	}
+
+	PropertyQuery = MoveTemp(CompiledQuery.GetValue());
+
+	for (const FAruActionSource& Source : ActionBuckets.GetSources())
+	{
+		bVisitsDependOnPath |= Algo::AnyOf(Source.Actions, [](const FAruActionDefinition& InAction) { return InAction.DependsOnContext(); });
+	}
+}
+
+bool FAruProcessingState::MarkVisited(
+	const UObject* InObject,
+	const int32 InRemainTime,
+	const FAruTraversalDepth& InDepth,
+	const FAruPropertyQuery::FStateSet InQueryStates,
+	const uint32 InPathHash)
+{
+	const FVisit NewVisit{InRemainTime, InDepth, InQueryStates};
+	TArray<FVisit, TInlineAllocator<1>>& Visits = VisitedObjects.FindOrAdd({FObjectKey{InObject}, InPathHash});
+	if (Visits.ContainsByPredicate([&NewVisit](const FVisit& InVisit) { return InVisit.Covers(NewVisit); }))
+	{
+		return false;
+	}
+
+	// Budgets of different visits can't be joined, e.g. one with more time left and one with fewer hops taken
+	// don't cover a visit in between. Only the records this visit covers are dropped.
+	Visits.RemoveAllSwap([&NewVisit](const FVisit& InVisit) { return NewVisit.Covers(InVisit); }, EAllowShrinking::No);
+	Visits.Add(NewVisit);
+	return true;
+}
+
+bool FAruProcessingState::CanDescendInto(const FObjectPropertyBase* InProperty, const UObject* InObject) const
+{
+	if (!Config.TraversalPolicy.bFollowExternalReferences
+		&& RootObject != nullptr
+		&& InObject->GetOutermost() != RootObject->GetOutermost())
+	{
+		return false;
+	}
+
+	if (!Config.bOnlyTraverseOwnedObjects)
+	{
+		return true;
+	}
+
+	return InProperty->HasAnyPropertyFlags(CPF_InstancedReference | CPF_PersistentInstance)
+		|| (RootObject != nullptr && InObject->IsIn(RootObject));
+}
+
+bool FAruProcessingState::CanDescend(const FAruTraversalDepth& InDepth, const EAruTraversalStep InStep) const
+{
+	const FAruTraversalPolicy& Policy = Config.TraversalPolicy;
+	switch (InStep)
+	{
+	case EAruTraversalStep::Object: return !Policy.bLimitObjectHops || InDepth.ObjectHops < Policy.MaxObjectHops;
+	case EAruTraversalStep::Struct: return !Policy.bLimitStructNesting || InDepth.StructNesting < Policy.MaxStructNesting;
+	case EAruTraversalStep::Container: return !Policy.bLimitContainerNesting || InDepth.ContainerNesting < Policy.MaxContainerNesting;
+	}
+	return true;
+}
+
+void FAruProcessingState::PrepareForModification(UObject* InObject)
+{
+	if (InObject == nullptr)
+	{
+		return;
+	}
+
+	bool bAlreadyModified = false;
+	ModifiedObjects.Add(FObjectKey{InObject}, &bAlreadyModified);
+	if (bAlreadyModified)
+	{
+		return;
+	}
+
+	const UPackage* Package = InObject->GetPackage();
+	if (!PackagesWereDirty.Contains(FObjectKey{Package}))
+	{
+		PackagesWereDirty.Add(FObjectKey{Package}, Package->IsDirty());
+	}
+	InObject->Modify();
+}
+
+void FAruProcessingState::RecordChanges(UObject* InObject, const int32 InNumChanges, const int32 InSourceIndex)
+{
+	if (InNumChanges <= 0)
+	{
+		return;
+	}
+
+	NumChanges += InNumChanges;
+	if (InSourceIndex >= NumChangesBySource.Num())
+	{
+		NumChangesBySource.SetNumZeroed(InSourceIndex + 1);
+	}
+	NumChangesBySource[InSourceIndex] += InNumChanges;
+	if (InObject != nullptr)
+	{
+		ChangedObjects.Add(FObjectKey{InObject});
+	}
+}
+
+bool FAruProcessingState::FinishModifications()
+{
+	const TArray<UPackage*> ChangedPackages = GetModifiedPackages();
+	for (const TPair<FObjectKey, bool>& Package : PackagesWereDirty)
+	{
+		UPackage* PackagePtr = Cast<UPackage>(Package.Key.ResolveObjectPtr());
+		if (PackagePtr != nullptr && !Package.Value && !ChangedPackages.Contains(PackagePtr))
 		{
-			void* MapKeyPtr = MapHelper.GetKeyPtr(Index);
-			void* MapValuePtr = MapHelper.GetValuePtr(Index);
-			bExecutedSuccessfully |= ProcessContainerValues(MapProperty->KeyProp, MapKeyPtr, InParameters.GetSubsequentParameters());
-			bExecutedSuccessfully |= ProcessContainerValues(MapProperty->ValueProp, MapValuePtr, InParameters.GetSubsequentParameters());
+			PackagePtr->SetDirtyFlag(false);
 		}
 	}
-	else if (FSetProperty* SetProperty = CastField<FSetProperty>(PropertyPtr))
+	return NumChanges > 0;
+}
+
+TArray<UPackage*> FAruProcessingState::GetModifiedPackages() const
+{
+	TSet<UPackage*> Packages;
+	for (const FObjectKey& ObjectKey : ChangedObjects)
 	{
-		FScriptSetHelper SetHelper{SetProperty, ValuePtr};
-		for (int32 Index = 0; Index < SetHelper.Num(); ++Index)
+		if (const UObject* Object = ObjectKey.ResolveObjectPtr())
 		{
-			void* ItemPtr = SetHelper.GetElementPtr(Index);
-			bExecutedSuccessfully |= ProcessContainerValues(SetProperty->ElementProp, ItemPtr, InParameters.GetSubsequentParameters());
+			Packages.Add(Object->GetPackage());
 		}
 	}
+	return Packages.Array();
+}
 
-	for (const auto& Action : InParameters.Actions)
+bool UAruFunctionLibrary::ProcessContainerValues(
+	FProperty* PropertyPtr,
+	void* ValuePtr,
+	const FAruProcessingParameters& InParameters)
+{
+	FAruPropertyTraversal Traversal{InParameters.State};
+	Traversal.AddProperty(PropertyPtr, ValuePtr, InParameters.RemainTime, InParameters.Depth);
+	Traversal.Run();
+	return Traversal.HasExecuted();
+}
+
+bool UAruFunctionLibrary::IsParameterizedString(const FString& SourceString)
+{
+	const int32 OpenBraceIndex = SourceString.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart);
+	return OpenBraceIndex != INDEX_NONE
+		&& SourceString.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, OpenBraceIndex + 1) != INDEX_NONE;
+}
+
+bool UAruFunctionLibrary::GetReferencedPath(const FProperty* InProperty, const void* InValue, FSoftObjectPath& OutPath)
+{
+	if (InProperty == nullptr || InValue == nullptr)
 	{
-		bExecutedSuccessfully |= Action.Invoke(PropertyPtr, ValuePtr, InParameters.Parameters);
+		return false;
 	}
 
-	return bExecutedSuccessfully;
+	// Checked first, soft object properties are object properties too and getting their object would load it.
+	if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(InProperty))
+	{
+		OutPath = SoftObjectProperty->GetPropertyValue(InValue).ToSoftObjectPath();
+		return true;
+	}
+
+	if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(InProperty))
+	{
+		OutPath = FSoftObjectPath{ObjectProperty->GetObjectPropertyValue(InValue)};
+		return true;
+	}
+
+	// FSoftClassPath values included.
+	const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+	if (StructProperty != nullptr && StructProperty->Struct->IsChildOf(TBaseStructure<FSoftObjectPath>::Get()))
+	{
+		OutPath = *static_cast<const FSoftObjectPath*>(InValue);
+		return true;
+	}
+
+	return false;
+}
+
+bool UAruFunctionLibrary::IsReferenceType(const FFieldClass* InFieldClass, const UScriptStruct* InStructType)
+{
+	return InFieldClass->IsChildOf(FObjectPropertyBase::StaticClass())
+		|| (InStructType != nullptr && InStructType->IsChildOf(TBaseStructure<FSoftObjectPath>::Get()));
+}
+
+bool UAruFunctionLibrary::IsSoftReference(const FProperty* InProperty)
+{
+	if (InProperty == nullptr)
+	{
+		return false;
+	}
+
+	const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+	return InProperty->IsA<FSoftObjectProperty>()
+		|| (StructProperty != nullptr && StructProperty->Struct->IsChildOf(TBaseStructure<FSoftObjectPath>::Get()));
 }
 
 FString UAruFunctionLibrary::ResolveParameterizedString(const FInstancedPropertyBag& InParameters, const FString& SourceString)
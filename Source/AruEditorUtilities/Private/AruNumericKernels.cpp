@@ -0,0 +1,358 @@
+﻿#include "AruNumericKernels.h"
+
+namespace Aru::Numeric
+{
+	template <typename ValueType>
+	struct TTypeTag
+	{
+		using Type = ValueType;
+	};
+
+	template <typename ValueType, ECompare Compare>
+	bool CompareValue(const void* InValue, const FOperand& InOperand)
+	{
+		const ValueType Value = *static_cast<const ValueType*>(InValue);
+		if constexpr (std::is_floating_point_v<ValueType>)
+		{
+			// Compare in the property's own precision, a float property is never compared against a double condition.
+			const ValueType Condition = static_cast<ValueType>(InOperand.Float);
+			if constexpr (Compare == ECompare::Equal) { return FMath::IsNearlyEqual(Value, Condition); }
+			if constexpr (Compare == ECompare::NotEqual) { return Value != Condition; }
+			if constexpr (Compare == ECompare::Greater) { return Value > Condition; }
+			if constexpr (Compare == ECompare::Less) { return Value < Condition; }
+			if constexpr (Compare == ECompare::GreaterOrEqual) { return Value >= Condition; }
+		}
+		else if constexpr (sizeof(ValueType) < sizeof(int64))
+		{
+			// Every integer up to 32 bits is exactly representable as a double.
+			const double DoubleValue = static_cast<double>(Value);
+			if constexpr (Compare == ECompare::Equal) { return DoubleValue == InOperand.Float; }
+			if constexpr (Compare == ECompare::NotEqual) { return DoubleValue != InOperand.Float; }
+			if constexpr (Compare == ECompare::Greater) { return DoubleValue > InOperand.Float; }
+			if constexpr (Compare == ECompare::Less) { return DoubleValue < InOperand.Float; }
+			if constexpr (Compare == ECompare::GreaterOrEqual) { return DoubleValue >= InOperand.Float; }
+		}
+		else
+		{
+			if (InOperand.ConstantResult.IsSet())
+			{
+				return InOperand.ConstantResult.GetValue();
+			}
+
+			ValueType Condition;
+			if constexpr (std::is_signed_v<ValueType>)
+			{
+				Condition = InOperand.Signed;
+			}
+			else
+			{
+				Condition = InOperand.Unsigned;
+			}
+
+			if constexpr (Compare == ECompare::Equal) { return Value == Condition; }
+			if constexpr (Compare == ECompare::NotEqual) { return Value != Condition; }
+			if constexpr (Compare == ECompare::Greater) { return Value > Condition; }
+			if constexpr (Compare == ECompare::Less) { return Value < Condition; }
+			if constexpr (Compare == ECompare::GreaterOrEqual) { return Value >= Condition; }
+		}
+		return false;
+	}
+
+	template <typename ValueType>
+	bool IsWithinRange(const void* InValue, const FOperand& InMin, const FOperand& InMax)
+	{
+		return CompareValue<ValueType, ECompare::GreaterOrEqual>(InValue, InMin)
+			&& CompareValue<ValueType, ECompare::Less>(InValue, InMax);
+	}
+
+	/** Clears the bits of the four values starting at InIndex whose result doesn't equal !bInvert. */
+	FORCEINLINE void MaskQuad(uint32* MatchWords, const int32 InIndex, const uint32 InResultBits, const bool bInvert)
+	{
+		const uint32 KeptBits = (bInvert ? ~InResultBits : InResultBits) & 0xFu;
+		// Quads start on a multiple of 4, so they never straddle two words.
+		MatchWords[InIndex >> 5] &= ~((~KeptBits & 0xFu) << (InIndex & 31));
+	}
+
+	template <ECompare Compare>
+	FORCEINLINE VectorRegister4Float CompareVector(const VectorRegister4Float& InValues, const VectorRegister4Float& InCondition)
+	{
+		if constexpr (Compare == ECompare::Equal)
+		{
+			// Same test as FMath::IsNearlyEqual with its default tolerance.
+			return VectorCompareLE(VectorAbs(VectorSubtract(InValues, InCondition)), VectorSetFloat1(UE_SMALL_NUMBER));
+		}
+		else if constexpr (Compare == ECompare::NotEqual) { return VectorCompareNE(InValues, InCondition); }
+		else if constexpr (Compare == ECompare::Greater) { return VectorCompareGT(InValues, InCondition); }
+		else if constexpr (Compare == ECompare::Less) { return VectorCompareLT(InValues, InCondition); }
+		else { return VectorCompareGE(InValues, InCondition); }
+	}
+
+	template <typename ValueType, ECompare Compare>
+	void CompareValues(const void* InValues, const int32 InNum, const FOperand& InOperand, const bool bInvert, TBitArray<>& InOutMatches)
+	{
+		const ValueType* Values = static_cast<const ValueType*>(InValues);
+		int32 Index = 0;
+		if constexpr (std::is_same_v<ValueType, float>)
+		{
+			uint32* MatchWords = InOutMatches.GetData();
+			const VectorRegister4Float ConditionVector = VectorSetFloat1(static_cast<float>(InOperand.Float));
+			for (; Index + 4 <= InNum; Index += 4)
+			{
+				const VectorRegister4Float ResultVector = CompareVector<Compare>(VectorLoad(Values + Index), ConditionVector);
+				MaskQuad(MatchWords, Index, static_cast<uint32>(VectorMaskBits(ResultVector)), bInvert);
+			}
+		}
+
+		for (; Index < InNum; ++Index)
+		{
+			if (InOutMatches[Index] && CompareValue<ValueType, Compare>(Values + Index, InOperand) == bInvert)
+			{
+				InOutMatches[Index] = false;
+			}
+		}
+	}
+
+	template <typename ValueType>
+	void AreWithinRange(const void* InValues, const int32 InNum, const FOperand& InMin, const FOperand& InMax, const bool bInvert, TBitArray<>& InOutMatches)
+	{
+		const ValueType* Values = static_cast<const ValueType*>(InValues);
+		int32 Index = 0;
+		if constexpr (std::is_same_v<ValueType, float>)
+		{
+			uint32* MatchWords = InOutMatches.GetData();
+			const VectorRegister4Float MinVector = VectorSetFloat1(static_cast<float>(InMin.Float));
+			const VectorRegister4Float MaxVector = VectorSetFloat1(static_cast<float>(InMax.Float));
+			for (; Index + 4 <= InNum; Index += 4)
+			{
+				const VectorRegister4Float ValueVector = VectorLoad(Values + Index);
+				const VectorRegister4Float ResultVector = VectorBitwiseAnd(VectorCompareGE(ValueVector, MinVector), VectorCompareLT(ValueVector, MaxVector));
+				MaskQuad(MatchWords, Index, static_cast<uint32>(VectorMaskBits(ResultVector)), bInvert);
+			}
+		}
+
+		for (; Index < InNum; ++Index)
+		{
+			if (InOutMatches[Index] && IsWithinRange<ValueType>(Values + Index, InMin, InMax) == bInvert)
+			{
+				InOutMatches[Index] = false;
+			}
+		}
+	}
+
+	template <typename ValueType, typename SourceType>
+	int32 SetMatchedValues(void* InValues, const int32 InNum, const TBitArray<>& InMatches, const SourceType InNewValue)
+	{
+		ValueType* Values = static_cast<ValueType*>(InValues);
+		const ValueType NewValue = static_cast<ValueType>(InNewValue);
+		int32 NumChanged = 0;
+		int32 Index = 0;
+		if constexpr (std::is_same_v<ValueType, float>)
+		{
+			// Fully matched quads are compared and written with single vector operations, the common case for unfiltered arrays.
+			const uint32* MatchWords = InMatches.GetData();
+			const VectorRegister4Float NewValueVector = VectorSetFloat1(NewValue);
+			for (; Index + 4 <= InNum; Index += 4)
+			{
+				const uint32 MatchBits = (MatchWords[Index >> 5] >> (Index & 31)) & 0xFu;
+				if (MatchBits == 0xFu)
+				{
+					const uint32 ChangedBits = VectorMaskBits(VectorCompareNE(VectorLoad(Values + Index), NewValueVector));
+					if (ChangedBits != 0)
+					{
+						VectorStore(NewValueVector, Values + Index);
+						NumChanged += FMath::CountBits(ChangedBits);
+					}
+					continue;
+				}
+
+				for (int32 Lane = 0; Lane < 4; ++Lane)
+				{
+					if ((MatchBits & (1u << Lane)) && Values[Index + Lane] != NewValue)
+					{
+						Values[Index + Lane] = NewValue;
+						++NumChanged;
+					}
+				}
+			}
+		}
+
+		for (; Index < InNum; ++Index)
+		{
+			if (InMatches[Index] && Values[Index] != NewValue)
+			{
+				Values[Index] = NewValue;
+				++NumChanged;
+			}
+		}
+		return NumChanged;
+	}
+
+	/**
+	 * 64 bit integers can't be compared through a double without losing precision,
+	 * so the condition is moved into the integer domain instead.
+	 */
+	template <typename ValueType>
+	FOperand MakeOperand(const double InCondition, const ECompare InCompare)
+	{
+		FOperand Operand;
+		Operand.Float = InCondition;
+		if constexpr (std::is_integral_v<ValueType> && sizeof(ValueType) == sizeof(int64))
+		{
+			// For integers 'V > C' equals 'V > floor(C)', while 'V < C' and 'V >= C' equal 'V < ceil(C)' and 'V >= ceil(C)'.
+			double Threshold = InCondition;
+			switch (InCompare)
+			{
+			case ECompare::Greater: Threshold = FMath::FloorToDouble(InCondition); break;
+			case ECompare::Less:
+			case ECompare::GreaterOrEqual: Threshold = FMath::CeilToDouble(InCondition); break;
+			default: break;
+			}
+
+			const bool bIsIntegral = Threshold == FMath::FloorToDouble(Threshold);
+			constexpr double LowerBound = std::is_signed_v<ValueType> ? -9223372036854775808.0 : 0.0;
+			constexpr double UpperBound = std::is_signed_v<ValueType> ? 9223372036854775808.0 : 18446744073709551616.0;
+			const bool bBelowRange = Threshold < LowerBound;
+			const bool bAboveRange = Threshold >= UpperBound;
+
+			if (InCompare == ECompare::Equal || InCompare == ECompare::NotEqual)
+			{
+				if (!bIsIntegral || bBelowRange || bAboveRange)
+				{
+					Operand.ConstantResult = InCompare == ECompare::NotEqual;
+					return Operand;
+				}
+			}
+			else if (!bIsIntegral)
+			{
+				// Only reachable with a NaN condition, which no ordering holds against.
+				Operand.ConstantResult = false;
+				return Operand;
+			}
+			else if (bBelowRange || bAboveRange)
+			{
+				// Every value of the type lies on the same side of the condition.
+				Operand.ConstantResult = bBelowRange == (InCompare != ECompare::Less);
+				return Operand;
+			}
+
+			if constexpr (std::is_signed_v<ValueType>)
+			{
+				Operand.Signed = static_cast<int64>(Threshold);
+			}
+			else
+			{
+				Operand.Unsigned = static_cast<uint64>(Threshold);
+			}
+		}
+		return Operand;
+	}
+
+	template <typename FunctorType>
+	bool DispatchNumericType(const FFieldClass* InFieldClass, FunctorType&& Functor)
+	{
+		if (InFieldClass == nullptr)
+		{
+			return false;
+		}
+
+		if (InFieldClass->IsChildOf(FFloatProperty::StaticClass())) { Functor(TTypeTag<float>{}); return true; }
+		if (InFieldClass->IsChildOf(FDoubleProperty::StaticClass())) { Functor(TTypeTag<double>{}); return true; }
+		if (InFieldClass->IsChildOf(FInt8Property::StaticClass())) { Functor(TTypeTag<int8>{}); return true; }
+		if (InFieldClass->IsChildOf(FInt16Property::StaticClass())) { Functor(TTypeTag<int16>{}); return true; }
+		if (InFieldClass->IsChildOf(FIntProperty::StaticClass())) { Functor(TTypeTag<int32>{}); return true; }
+		if (InFieldClass->IsChildOf(FInt64Property::StaticClass())) { Functor(TTypeTag<int64>{}); return true; }
+		if (InFieldClass->IsChildOf(FByteProperty::StaticClass())) { Functor(TTypeTag<uint8>{}); return true; }
+		if (InFieldClass->IsChildOf(FUInt16Property::StaticClass())) { Functor(TTypeTag<uint16>{}); return true; }
+		if (InFieldClass->IsChildOf(FUInt32Property::StaticClass())) { Functor(TTypeTag<uint32>{}); return true; }
+		if (InFieldClass->IsChildOf(FUInt64Property::StaticClass())) { Functor(TTypeTag<uint64>{}); return true; }
+		return false;
+	}
+
+	ECompare ToCompare(const EAruNumericCompareOp InCompareOp)
+	{
+		switch (InCompareOp)
+		{
+		case EAruNumericCompareOp::Equip: return ECompare::Equal;
+		case EAruNumericCompareOp::NotEqual: return ECompare::NotEqual;
+		case EAruNumericCompareOp::GreaterThan: return ECompare::Greater;
+		case EAruNumericCompareOp::LessThan: return ECompare::Less;
+		}
+		return ECompare::Equal;
+	}
+
+	void Bind(const FFieldClass* InFieldClass, const ECompare InCompare, const double InCondition, FCompareBinding& OutBinding)
+	{
+		OutBinding = FCompareBinding{};
+		OutBinding.FieldClass = InFieldClass;
+		DispatchNumericType(InFieldClass, [&](auto TypeTag)
+		{
+			using ValueType = typename decltype(TypeTag)::Type;
+			switch (InCompare)
+			{
+			case ECompare::Equal:
+				OutBinding.Kernel = &CompareValue<ValueType, ECompare::Equal>;
+				OutBinding.BatchKernel = &CompareValues<ValueType, ECompare::Equal>;
+				break;
+			case ECompare::NotEqual:
+				OutBinding.Kernel = &CompareValue<ValueType, ECompare::NotEqual>;
+				OutBinding.BatchKernel = &CompareValues<ValueType, ECompare::NotEqual>;
+				break;
+			case ECompare::Greater:
+				OutBinding.Kernel = &CompareValue<ValueType, ECompare::Greater>;
+				OutBinding.BatchKernel = &CompareValues<ValueType, ECompare::Greater>;
+				break;
+			case ECompare::Less:
+				OutBinding.Kernel = &CompareValue<ValueType, ECompare::Less>;
+				OutBinding.BatchKernel = &CompareValues<ValueType, ECompare::Less>;
+				break;
+			case ECompare::GreaterOrEqual:
+				OutBinding.Kernel = &CompareValue<ValueType, ECompare::GreaterOrEqual>;
+				OutBinding.BatchKernel = &CompareValues<ValueType, ECompare::GreaterOrEqual>;
+				break;
+			}
+			OutBinding.Operand = MakeOperand<ValueType>(InCondition, InCompare);
+		});
+	}
+
+	void Bind(const FFieldClass* InFieldClass, const double InMin, const double InMax, FRangeBinding& OutBinding)
+	{
+		OutBinding = FRangeBinding{};
+		OutBinding.FieldClass = InFieldClass;
+		DispatchNumericType(InFieldClass, [&](auto TypeTag)
+		{
+			using ValueType = typename decltype(TypeTag)::Type;
+			OutBinding.Kernel = &IsWithinRange<ValueType>;
+			OutBinding.BatchKernel = &AreWithinRange<ValueType>;
+			OutBinding.Min = MakeOperand<ValueType>(InMin, ECompare::GreaterOrEqual);
+			OutBinding.Max = MakeOperand<ValueType>(InMax, ECompare::Less);
+		});
+	}
+
+	int32 SetValues(const FFieldClass* InFieldClass, void* InValues, const int32 InNum, const TBitArray<>& InMatches, const double InNewValue)
+	{
+		int32 NumWritten = INDEX_NONE;
+		DispatchNumericType(InFieldClass, [&](auto TypeTag)
+		{
+			using ValueType = typename decltype(TypeTag)::Type;
+			if constexpr (std::is_floating_point_v<ValueType>)
+			{
+				NumWritten = SetMatchedValues<ValueType>(InValues, InNum, InMatches, InNewValue);
+			}
+		});
+		return NumWritten;
+	}
+
+	int32 SetValues(const FFieldClass* InFieldClass, void* InValues, const int32 InNum, const TBitArray<>& InMatches, const int64 InNewValue)
+	{
+		int32 NumWritten = INDEX_NONE;
+		DispatchNumericType(InFieldClass, [&](auto TypeTag)
+		{
+			using ValueType = typename decltype(TypeTag)::Type;
+			if constexpr (std::is_integral_v<ValueType>)
+			{
+				NumWritten = SetMatchedValues<ValueType>(InValues, InNum, InMatches, InNewValue);
+			}
+		});
+		return NumWritten;
+	}
+}
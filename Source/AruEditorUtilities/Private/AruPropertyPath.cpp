@@ -0,0 +1,52 @@
+﻿#include "AruPropertyPath.h"
+#include "AruPropertyTraversal.h"
+
+FString FAruPropertyPath::ToString() const
+{
+	FString Path;
+	for (const FAruPropertyPathSegment& Segment : Segments)
+	{
+		if (Segment.IsItem())
+		{
+			Path.Appendf(TEXT("[%d]"), Segment.Index);
+			continue;
+		}
+
+		if (!Path.IsEmpty())
+		{
+			Path += TEXT('.');
+		}
+		Segment.Name.AppendString(Path);
+	}
+	return Path;
+}
+
+TOptional<FAruPropertyPath> FAruPropertyPath::GetCurrent()
+{
+	const FAruPropertyTraversal* Traversal = FAruPropertyTraversal::GetCurrent();
+	if (Traversal == nullptr)
+	{
+		return {};
+	}
+
+	return Traversal->GetCurrentPath();
+}
+
+FString Aru::GetPropertyDisplayPath(const FProperty* InProperty)
+{
+	if (InProperty == nullptr)
+	{
+		return {};
+	}
+
+	if (const FAruPropertyTraversal* Traversal = FAruPropertyTraversal::GetCurrent())
+	{
+		const FAruPropertyPath Path = Traversal->GetCurrentPath();
+		if (Path.GetLeafProperty() == InProperty)
+		{
+			return Path.ToString();
+		}
+	}
+
+	return InProperty->GetName();
+}
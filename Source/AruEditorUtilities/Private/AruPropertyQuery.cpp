@@ -0,0 +1,240 @@
+﻿#include "AruPropertyQuery.h"
+#include "AruPropertyPath.h"
+
+TOptional<FAruPropertyQuery> FAruPropertyQuery::Compile(const FString& InQuery)
+{
+	FAruPropertyQuery Query;
+
+	int32 Cursor = 0;
+	while (Cursor < InQuery.Len())
+	{
+		const TCHAR Character = InQuery[Cursor];
+		if (Character == TEXT('.') || FChar::IsWhitespace(Character))
+		{
+			++Cursor;
+			continue;
+		}
+
+		FStep Step;
+		if (Character == TEXT('['))
+		{
+			const int32 CloseIndex = InQuery.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Cursor);
+			if (CloseIndex == INDEX_NONE)
+			{
+				return {};
+			}
+
+			const FString Selector = InQuery.Mid(Cursor + 1, CloseIndex - Cursor - 1).TrimStartAndEnd();
+			Cursor = CloseIndex + 1;
+			if (Selector.IsEmpty())
+			{
+				return {};
+			}
+
+			if (Selector == TEXT("*"))
+			{
+				Step.Kind = EStepKind::AnyItem;
+			}
+			else if (Selector.IsNumeric())
+			{
+				Step.Kind = EStepKind::Item;
+				Step.Index = FCString::Atoi(*Selector);
+			}
+			else
+			{
+				Step.Kind = EStepKind::ItemKey;
+				Step.Key = Selector.TrimQuotes();
+				Step.Name = FName{Step.Key};
+			}
+		}
+		else
+		{
+			int32 NameEnd = Cursor;
+			while (NameEnd < InQuery.Len() && InQuery[NameEnd] != TEXT('.') && InQuery[NameEnd] != TEXT('['))
+			{
+				++NameEnd;
+			}
+
+			const FString Name = InQuery.Mid(Cursor, NameEnd - Cursor).TrimStartAndEnd();
+			Cursor = NameEnd;
+			if (Name == TEXT("**"))
+			{
+				Step.Kind = EStepKind::Recursive;
+			}
+			else if (Name == TEXT("*"))
+			{
+				Step.Kind = EStepKind::AnyMember;
+			}
+			else if (Name.Contains(TEXT("*")))
+			{
+				return {};
+			}
+			else
+			{
+				Step.Kind = EStepKind::Member;
+				Step.Name = FName{Name};
+			}
+		}
+
+		Query.Steps.Add(MoveTemp(Step));
+		if (Query.Steps.Num() > MaxSteps)
+		{
+			return {};
+		}
+	}
+
+	return Query;
+}
+
+FAruPropertyQuery::FStateSet FAruPropertyQuery::GetInitialStates() const
+{
+	if (IsEmpty())
+	{
+		return 0;
+	}
+	return Close(FStateSet{1});
+}
+
+FAruPropertyQuery::FStateSet FAruPropertyQuery::AdvanceMember(const FStateSet InStates, const FName InName) const
+{
+	FStateSet NextStates = 0;
+	for (int32 StepIndex = 0; StepIndex < Steps.Num(); ++StepIndex)
+	{
+		if ((InStates & (FStateSet{1} << StepIndex)) == 0)
+		{
+			continue;
+		}
+
+		const FStep& Step = Steps[StepIndex];
+		switch (Step.Kind)
+		{
+		case EStepKind::Member:
+			if (Step.Name == InName)
+			{
+				NextStates |= FStateSet{1} << (StepIndex + 1);
+			}
+			break;
+		case EStepKind::AnyMember:
+			NextStates |= FStateSet{1} << (StepIndex + 1);
+			break;
+		case EStepKind::Recursive:
+			NextStates |= FStateSet{1} << StepIndex;
+			break;
+		default:
+			break;
+		}
+	}
+	return Close(NextStates);
+}
+
+FAruPropertyQuery::FStateSet FAruPropertyQuery::AdvanceItem(
+	const FStateSet InStates,
+	const int32 InIndex,
+	const FProperty* InKeyProperty,
+	const void* InKeyValue) const
+{
+	FStateSet NextStates = 0;
+	for (int32 StepIndex = 0; StepIndex < Steps.Num(); ++StepIndex)
+	{
+		if ((InStates & (FStateSet{1} << StepIndex)) == 0)
+		{
+			continue;
+		}
+
+		const FStep& Step = Steps[StepIndex];
+		switch (Step.Kind)
+		{
+		case EStepKind::Item:
+			if (Step.Index == InIndex)
+			{
+				NextStates |= FStateSet{1} << (StepIndex + 1);
+			}
+			break;
+		case EStepKind::AnyItem:
+			NextStates |= FStateSet{1} << (StepIndex + 1);
+			break;
+		case EStepKind::ItemKey:
+			if (MatchesKey(Step, InKeyProperty, InKeyValue))
+			{
+				NextStates |= FStateSet{1} << (StepIndex + 1);
+			}
+			break;
+		case EStepKind::Recursive:
+			NextStates |= FStateSet{1} << StepIndex;
+			break;
+		default:
+			break;
+		}
+	}
+	return Close(NextStates);
+}
+
+bool FAruPropertyQuery::IsItemSelective(const FStateSet InStates) const
+{
+	for (int32 StepIndex = 0; StepIndex < Steps.Num(); ++StepIndex)
+	{
+		if ((InStates & (FStateSet{1} << StepIndex)) != 0
+			&& (Steps[StepIndex].Kind == EStepKind::Item || Steps[StepIndex].Kind == EStepKind::ItemKey))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FAruPropertyQuery::Matches(const FAruPropertyPath& InPath, const bool bIncludeNested) const
+{
+	FStateSet States = GetInitialStates();
+	for (const FAruPropertyPathSegment& Segment : InPath.GetSegments())
+	{
+		States = Segment.IsItem()
+			? AdvanceItem(States, Segment.Index, Segment.Property, Segment.Value)
+			: AdvanceMember(States, Segment.Name);
+
+		if (bIncludeNested && IsMatch(States))
+		{
+			return true;
+		}
+
+		if (States == 0)
+		{
+			return false;
+		}
+	}
+	return IsMatch(States);
+}
+
+FAruPropertyQuery::FStateSet FAruPropertyQuery::Close(FStateSet InStates) const
+{
+	// "**" may match no segment, so reaching it also reaches the step after it. Ascending order picks up chained ones.
+	for (int32 StepIndex = 0; StepIndex < Steps.Num(); ++StepIndex)
+	{
+		if ((InStates & (FStateSet{1} << StepIndex)) != 0 && Steps[StepIndex].Kind == EStepKind::Recursive)
+		{
+			InStates |= FStateSet{1} << (StepIndex + 1);
+		}
+	}
+	return InStates;
+}
+
+bool FAruPropertyQuery::MatchesKey(const FStep& InStep, const FProperty* InKeyProperty, const void* InKeyValue)
+{
+	if (InKeyProperty == nullptr || InKeyValue == nullptr)
+	{
+		return false;
+	}
+
+	if (const FNameProperty* NameProperty = CastField<FNameProperty>(InKeyProperty))
+	{
+		return NameProperty->GetPropertyValue(InKeyValue) == InStep.Name;
+	}
+
+	if (const FStrProperty* StrProperty = CastField<FStrProperty>(InKeyProperty))
+	{
+		return StrProperty->GetPropertyValue(InKeyValue).Equals(InStep.Key, ESearchCase::IgnoreCase);
+	}
+
+	FString KeyText;
+	InKeyProperty->ExportTextItem_Direct(KeyText, InKeyValue, nullptr, nullptr, PPF_None);
+	return KeyText.Equals(InStep.Key, ESearchCase::IgnoreCase);
+}
@@ -0,0 +1,487 @@
+﻿#include "AruPropertyTraversal.h"
+#include "GameplayTagContainer.h"
+#include "Algo/Reverse.h"
+#include "Engine/Blueprint.h"
+#include "StructUtils/InstancedStruct.h"
+
+namespace Aru::Traversal
+{
+	static thread_local const FAruPropertyTraversal* CurrentTraversal = nullptr;
+
+	// Frames processed between two reads of the clock when running on a time budget.
+	static constexpr int32 FramesPerTimeCheck = 64;
+
+	// Member names the key and value of a map pair are reached by in paths and queries.
+	static const FName& GetMapKeyName()
+	{
+		static const FName KeyName{"Key"};
+		return KeyName;
+	}
+
+	static const FName& GetMapValueName()
+	{
+		static const FName ValueName{"Value"};
+		return ValueName;
+	}
+}
+
+void FAruPropertyTraversal::AddProperty(FProperty* InProperty, void* InValue, const int32 InRemainTime, const FAruTraversalDepth& InDepth, UObject* InOwner)
+{
+	FFrame Frame;
+	Frame.Property = InProperty;
+	Frame.Value = InValue;
+	Frame.RemainTime = InRemainTime;
+	Frame.Depth = InDepth;
+	Frame.Owner = InOwner;
+	Frame.QueryStates = State.PropertyQuery.AdvanceMember(State.PropertyQuery.GetInitialStates(), InProperty != nullptr ? InProperty->GetFName() : NAME_None);
+	PushFrame(Frame);
+}
+
+void FAruPropertyTraversal::AddProperties(const UStruct* InType, void* InContainer, const int32 InRemainTime, const FAruTraversalDepth& InDepth)
+{
+	if (InType == nullptr || InContainer == nullptr)
+	{
+		return;
+	}
+
+	const int32 FirstFrame = Frames.Num();
+	UObject* Owner = InType->IsA<UClass>() ? static_cast<UObject*>(InContainer) : nullptr;
+	PushProperties(InType, InContainer, INDEX_NONE, InRemainTime, InDepth, State.PropertyQuery.GetInitialStates(), Owner);
+	ReverseFrom(FirstFrame);
+}
+
+bool FAruPropertyTraversal::Run(const double InMaxSeconds)
+{
+	TGuardValue<const FAruPropertyTraversal*> CurrentTraversalGuard{Aru::Traversal::CurrentTraversal, this};
+
+	const double EndTime = InMaxSeconds > 0.0 ? FPlatformTime::Seconds() + InMaxSeconds : 0.0;
+	int32 FramesSinceTimeCheck = 0;
+	while (!Frames.IsEmpty())
+	{
+		if (EndTime > 0.0 && ++FramesSinceTimeCheck >= Aru::Traversal::FramesPerTimeCheck)
+		{
+			FramesSinceTimeCheck = 0;
+			if (FPlatformTime::Seconds() >= EndTime)
+			{
+				return false;
+			}
+		}
+
+		const int32 FrameIndex = Frames.Num() - 1;
+		if (!Frames[FrameIndex].bExpanded)
+		{
+			Frames[FrameIndex].bExpanded = true;
+			Expand(FrameIndex);
+			continue;
+		}
+
+		Visit(FrameIndex);
+		Frames.Pop(EAllowShrinking::No);
+	}
+	return true;
+}
+
+FAruPropertyPath FAruPropertyTraversal::GetCurrentPath() const
+{
+	TArray<int32, TInlineAllocator<16>> Chain;
+	for (int32 FrameIndex = CurrentFrame; FrameIndex != INDEX_NONE; FrameIndex = Frames[FrameIndex].Parent)
+	{
+		Chain.Add(FrameIndex);
+	}
+
+	FAruPropertyPath Path;
+	for (int32 ChainIndex = Chain.Num() - 1; ChainIndex >= 0; --ChainIndex)
+	{
+		const FFrame& Frame = Frames[Chain[ChainIndex]];
+		switch (Frame.ItemKind)
+		{
+		case EItemKind::None:
+			Path.AddMember(Frame.Property, Frame.Value);
+			break;
+		case EItemKind::Element:
+			Path.AddItem(Frame.ItemIndex, Frame.Property, Frame.Value);
+			break;
+		case EItemKind::MapKey:
+		case EItemKind::MapValue:
+		{
+			const FMapProperty* MapProperty = CastFieldChecked<FMapProperty>(Frames[Frame.Parent].Property);
+			Path.AddItem(Frame.ItemIndex, MapProperty->KeyProp, Frame.ItemKey);
+			Path.AddMember(
+				Frame.ItemKind == EItemKind::MapKey ? Aru::Traversal::GetMapKeyName() : Aru::Traversal::GetMapValueName(),
+				Frame.Property,
+				Frame.Value);
+			break;
+		}
+		}
+	}
+	return Path;
+}
+
+uint32 FAruPropertyTraversal::HashPathTo(const int32 InFrameIndex) const
+{
+	uint32 Hash = 0;
+	for (int32 FrameIndex = InFrameIndex; FrameIndex != INDEX_NONE; FrameIndex = Frames[FrameIndex].Parent)
+	{
+		const FFrame& Frame = Frames[FrameIndex];
+		Hash = HashCombineFast(Hash, GetTypeHash(Frame.Property));
+		Hash = HashCombineFast(Hash, HashCombineFast(GetTypeHash(Frame.ItemIndex), GetTypeHash(static_cast<uint8>(Frame.ItemKind))));
+	}
+	return Hash;
+}
+
+const FAruPropertyTraversal* FAruPropertyTraversal::GetCurrent()
+{
+	return Aru::Traversal::CurrentTraversal;
+}
+
+void FAruPropertyTraversal::PushFrame(const FFrame& InFrame)
+{
+	if (InFrame.RemainTime <= 0 || InFrame.Property == nullptr || InFrame.Value == nullptr)
+	{
+		return;
+	}
+
+	// Nothing at or below a frame no query path goes through can be matched.
+	if (!State.PropertyQuery.IsEmpty() && InFrame.QueryStates == 0)
+	{
+		return;
+	}
+
+	Frames.Add(InFrame);
+}
+
+void FAruPropertyTraversal::PushProperties(
+	const UStruct* InType,
+	void* InContainer,
+	const int32 InParent,
+	const int32 InRemainTime,
+	const FAruTraversalDepth& InDepth,
+	const FAruPropertyQuery::FStateSet InQueryStates,
+	UObject* InOwner)
+{
+	for (TFieldIterator<FProperty> It{InType}; It; ++It)
+	{
+		FFrame Frame;
+		Frame.Property = *It;
+		Frame.Value = Frame.Property != nullptr ? Frame.Property->ContainerPtrToValuePtr<void>(InContainer) : nullptr;
+		Frame.RemainTime = InRemainTime;
+		Frame.Depth = InDepth;
+		Frame.Parent = InParent;
+		Frame.Owner = InOwner;
+		Frame.QueryStates = Frame.Property != nullptr ? State.PropertyQuery.AdvanceMember(InQueryStates, Frame.Property->GetFName()) : 0;
+		PushFrame(Frame);
+	}
+}
+
+void FAruPropertyTraversal::ReverseFrom(const int32 InFirstFrame)
+{
+	// Frames are pushed in declaration order, reversing them makes the first one get processed first.
+	Algo::Reverse(MakeArrayView(Frames.GetData() + InFirstFrame, Frames.Num() - InFirstFrame));
+}
+
+void FAruPropertyTraversal::Expand(const int32 InFrameIndex)
+{
+	// Copied, pushing nested frames may reallocate the stack.
+	const FFrame Frame = Frames[InFrameIndex];
+	const int32 FirstNestedFrame = Frames.Num();
+
+	if (!State.PropertyQuery.IsEmpty() && !State.PropertyQuery.CanContinue(Frame.QueryStates))
+	{
+		return;
+	}
+
+	if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Frame.Property))
+	{
+		ExpandObject(Frame, InFrameIndex, ObjectProperty);
+	}
+	else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Frame.Property))
+	{
+		ExpandStruct(Frame, InFrameIndex, StructProperty);
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Frame.Property))
+	{
+		ExpandArray(Frame, InFrameIndex, ArrayProperty);
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Frame.Property))
+	{
+		ExpandMap(Frame, InFrameIndex, MapProperty);
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Frame.Property))
+	{
+		ExpandSet(Frame, InFrameIndex, SetProperty);
+	}
+
+	ReverseFrom(FirstNestedFrame);
+}
+
+void FAruPropertyTraversal::ExpandObject(const FFrame& InFrame, const int32 InFrameIndex, const FObjectPropertyBase* InProperty)
+{
+	if (!State.CanDescend(InFrame.Depth, EAruTraversalStep::Object))
+	{
+		return;
+	}
+
+	UObject* NativeObject = InProperty->GetObjectPropertyValue(InFrame.Value);
+	if (NativeObject == nullptr)
+	{
+		return;
+	}
+
+	UClass* NativeClass = NativeObject->GetClass();
+	if (NativeClass == nullptr)
+	{
+		return;
+	}
+
+	if (!State.CanDescendInto(InProperty, NativeObject))
+	{
+		return;
+	}
+
+	if (UBlueprint* BlueprintAsset = Cast<UBlueprint>(NativeObject))
+	{
+		NativeClass = BlueprintAsset->GeneratedClass;
+		NativeObject = NativeClass->GetDefaultObject();
+	}
+
+	const FAruTraversalDepth NestedDepth = InFrame.Depth.Step(EAruTraversalStep::Object);
+	const uint32 PathHash = State.bVisitsDependOnPath ? HashPathTo(InFrameIndex) : 0;
+	if (!State.MarkVisited(NativeObject, InFrame.RemainTime - 1, NestedDepth, InFrame.QueryStates, PathHash))
+	{
+		return;
+	}
+
+	PushProperties(NativeClass, NativeObject, InFrameIndex, InFrame.RemainTime - 1, NestedDepth, InFrame.QueryStates, NativeObject);
+}
+
+void FAruPropertyTraversal::ExpandStruct(const FFrame& InFrame, const int32 InFrameIndex, const FStructProperty* InProperty)
+{
+	const UScriptStruct* StructType = InProperty->Struct;
+	if (StructType == nullptr)
+	{
+		return;
+	}
+
+	// Tags are edited as a whole by the gameplay tag predicates, descending into their internals
+	// would let predicates desync a container's tags from its parent tag cache.
+	if (StructType == FGameplayTag::StaticStruct()
+		|| StructType == FGameplayTagQuery::StaticStruct()
+		|| StructType == FGameplayTagContainer::StaticStruct())
+	{
+		return;
+	}
+
+	if (!State.CanDescend(InFrame.Depth, EAruTraversalStep::Struct))
+	{
+		return;
+	}
+
+	void* StructContainer = InFrame.Value;
+	if (StructType == FInstancedStruct::StaticStruct())
+	{
+		FInstancedStruct* InstancedStructPtr = static_cast<FInstancedStruct*>(InFrame.Value);
+		if (!InstancedStructPtr->IsValid())
+		{
+			return;
+		}
+
+		StructType = InstancedStructPtr->GetScriptStruct();
+		StructContainer = InstancedStructPtr->GetMutableMemory();
+		if (StructType == nullptr || StructContainer == nullptr)
+		{
+			return;
+		}
+	}
+
+	PushProperties(StructType, StructContainer, InFrameIndex, InFrame.RemainTime - 1, InFrame.Depth.Step(EAruTraversalStep::Struct), InFrame.QueryStates, InFrame.Owner);
+}
+
+void FAruPropertyTraversal::ExpandArray(const FFrame& InFrame, const int32 InFrameIndex, const FArrayProperty* InProperty)
+{
+	if (!State.CanDescend(InFrame.Depth, EAruTraversalStep::Container))
+	{
+		return;
+	}
+
+	const FAruPropertyQuery& Query = State.PropertyQuery;
+	FScriptArrayHelper ArrayHelper{InProperty, InFrame.Value};
+	if (InProperty->Inner->IsA<FNumericProperty>() && !Query.IsItemSelective(InFrame.QueryStates))
+	{
+		// Numeric items are leaves, so each action can run over the whole array at once instead of per item.
+		// Without index or key selectors pending, either every item matches the query or none does.
+		const bool bItemsMatch = Query.IsEmpty() || Query.IsMatch(Query.AdvanceItem(InFrame.QueryStates, 0));
+		if (bItemsMatch && ArrayHelper.Num() > 0 && InFrame.RemainTime > 1)
+		{
+			TGuardValue<int32> CurrentFrameGuard{CurrentFrame, InFrameIndex};
+			for (const FAruBoundAction& Bound : State.ActionBuckets.Find(InProperty->Inner))
+			{
+				if (!Bound.Reaches(InFrame.RemainTime - 1))
+				{
+					continue;
+				}
+
+				TBitArray<> Matches;
+				if (Bound.Action->AreConditionsMetBatch(InProperty->Inner, ArrayHelper.GetRawPtr(0), ArrayHelper.Num(), *Bound.Parameters, Matches))
+				{
+					State.PrepareForModification(InFrame.Owner);
+					const int32 NumChanged = Bound.Action->ExecutePredicatesBatch(InProperty->Inner, ArrayHelper.GetRawPtr(0), ArrayHelper.Num(), Matches, *Bound.Parameters);
+					State.RecordChanges(InFrame.Owner, NumChanged, Bound.SourceIndex);
+					bExecutedSuccessfully |= NumChanged > 0;
+				}
+			}
+		}
+		return;
+	}
+
+	const FAruTraversalDepth NestedDepth = InFrame.Depth.Step(EAruTraversalStep::Container);
+	for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+	{
+		FFrame Frame;
+		Frame.Property = InProperty->Inner;
+		Frame.Value = ArrayHelper.GetRawPtr(Index);
+		Frame.RemainTime = InFrame.RemainTime - 1;
+		Frame.Depth = NestedDepth;
+		Frame.Parent = InFrameIndex;
+		Frame.Owner = InFrame.Owner;
+		Frame.ItemIndex = Index;
+		Frame.ItemKind = EItemKind::Element;
+		Frame.QueryStates = Query.AdvanceItem(InFrame.QueryStates, Index, Frame.Property, Frame.Value);
+		PushFrame(Frame);
+	}
+}
+
+void FAruPropertyTraversal::ExpandMap(const FFrame& InFrame, const int32 InFrameIndex, const FMapProperty* InProperty)
+{
+	if (!State.CanDescend(InFrame.Depth, EAruTraversalStep::Container))
+	{
+		return;
+	}
+
+	const FAruPropertyQuery& Query = State.PropertyQuery;
+	FScriptMapHelper MapHelper{InProperty, InFrame.Value};
+	const FAruTraversalDepth NestedDepth = InFrame.Depth.Step(EAruTraversalStep::Container);
+	for (FScriptMapHelper::FIterator It{MapHelper}; It; ++It)
+	{
+		void* KeyPtr = MapHelper.GetKeyPtr(It.GetInternalIndex());
+		const FAruPropertyQuery::FStateSet PairStates = Query.AdvanceItem(InFrame.QueryStates, It.GetLogicalIndex(), InProperty->KeyProp, KeyPtr);
+
+		FFrame KeyFrame;
+		KeyFrame.Property = InProperty->KeyProp;
+		KeyFrame.Value = KeyPtr;
+		KeyFrame.RemainTime = InFrame.RemainTime - 1;
+		KeyFrame.Depth = NestedDepth;
+		KeyFrame.Parent = InFrameIndex;
+		KeyFrame.Owner = InFrame.Owner;
+		KeyFrame.ItemIndex = It.GetLogicalIndex();
+		KeyFrame.ItemKind = EItemKind::MapKey;
+		KeyFrame.ItemKey = KeyPtr;
+		KeyFrame.QueryStates = Query.AdvanceMember(PairStates, Aru::Traversal::GetMapKeyName());
+		PushFrame(KeyFrame);
+
+		FFrame ValueFrame = KeyFrame;
+		ValueFrame.Property = InProperty->ValueProp;
+		ValueFrame.Value = MapHelper.GetValuePtr(It.GetInternalIndex());
+		ValueFrame.ItemKind = EItemKind::MapValue;
+		ValueFrame.QueryStates = Query.AdvanceMember(PairStates, Aru::Traversal::GetMapValueName());
+		PushFrame(ValueFrame);
+	}
+}
+
+void FAruPropertyTraversal::ExpandSet(const FFrame& InFrame, const int32 InFrameIndex, const FSetProperty* InProperty)
+{
+	if (!State.CanDescend(InFrame.Depth, EAruTraversalStep::Container))
+	{
+		return;
+	}
+
+	FScriptSetHelper SetHelper{InProperty, InFrame.Value};
+	const FAruTraversalDepth NestedDepth = InFrame.Depth.Step(EAruTraversalStep::Container);
+	for (FScriptSetHelper::FIterator It{SetHelper}; It; ++It)
+	{
+		FFrame Frame;
+		Frame.Property = InProperty->ElementProp;
+		Frame.Value = SetHelper.GetElementPtr(It.GetInternalIndex());
+		Frame.RemainTime = InFrame.RemainTime - 1;
+		Frame.Depth = NestedDepth;
+		Frame.Parent = InFrameIndex;
+		Frame.Owner = InFrame.Owner;
+		Frame.ItemIndex = It.GetLogicalIndex();
+		Frame.ItemKind = EItemKind::Element;
+		Frame.QueryStates = State.PropertyQuery.AdvanceItem(InFrame.QueryStates, Frame.ItemIndex, Frame.Property, Frame.Value);
+		PushFrame(Frame);
+	}
+}
+
+void FAruPropertyTraversal::Visit(const int32 InFrameIndex)
+{
+	TGuardValue<int32> CurrentFrameGuard{CurrentFrame, InFrameIndex};
+
+	const FFrame& Frame = Frames[InFrameIndex];
+	if (!State.PropertyQuery.IsEmpty() && !State.PropertyQuery.IsMatch(Frame.QueryStates))
+	{
+		return;
+	}
+
+	// Struct values are hashed lazily, and again after a predicate ran as it may have changed the value.
+	const FStructProperty* MemoizedProperty = State.Config.bMemoizeStructConditions ? CastField<FStructProperty>(Frame.Property) : nullptr;
+	TOptional<uint32> ValueHash;
+
+	// Outcomes of the conditions ignoring the parameters, for actions bound once per parameter set.
+	TArray<TPair<const FAruActionDefinition*, bool>, TInlineAllocator<4>> ParameterFreeOutcomes;
+	for (const FAruBoundAction& Bound : State.ActionBuckets.Find(Frame.Property))
+	{
+		if (!Bound.Reaches(Frame.RemainTime))
+		{
+			continue;
+		}
+
+		const FAruActionDefinition* Action = Bound.Action;
+		bool bConditionsMet = false;
+		if (MemoizedProperty != nullptr && !Action->DependsOnContext())
+		{
+			if (!ValueHash.IsSet())
+			{
+				ValueHash = FAruConditionMemo::HashValue(MemoizedProperty, Frame.Value);
+			}
+
+			const TOptional<bool> MemoizedOutcome = State.ConditionMemo.Find(Bound, MemoizedProperty, Frame.Value, ValueHash.GetValue());
+			bConditionsMet = MemoizedOutcome.IsSet() ? MemoizedOutcome.GetValue() : Bound.AreConditionsMet(Frame.Property, Frame.Value);
+			if (!MemoizedOutcome.IsSet())
+			{
+				State.ConditionMemo.Add(Bound, MemoizedProperty, Frame.Value, ValueHash.GetValue(), bConditionsMet);
+			}
+		}
+		else if (Bound.bShared)
+		{
+			const TPair<const FAruActionDefinition*, bool>* ParameterFreeOutcome = ParameterFreeOutcomes.FindByPredicate(
+				[Action](const TPair<const FAruActionDefinition*, bool>& InOutcome) { return InOutcome.Key == Action; });
+			if (ParameterFreeOutcome == nullptr)
+			{
+				ParameterFreeOutcome = &ParameterFreeOutcomes.Emplace_GetRef(Action, Bound.AreConditionsMet(Frame.Property, Frame.Value, EAruConditionScope::ParameterFree));
+			}
+			bConditionsMet = ParameterFreeOutcome->Value && Bound.AreConditionsMet(Frame.Property, Frame.Value, EAruConditionScope::Parameterized);
+		}
+		else
+		{
+			bConditionsMet = Bound.AreConditionsMet(Frame.Property, Frame.Value);
+		}
+
+		if (bConditionsMet)
+		{
+			State.PrepareForModification(Frame.Owner);
+			const bool bChanged = Bound.ExecutePredicates(Frame.Property, Frame.Value);
+			State.RecordChanges(Frame.Owner, bChanged ? 1 : 0, Bound.SourceIndex);
+			bExecutedSuccessfully |= bChanged;
+			if (bChanged)
+			{
+				ValueHash.Reset();
+				ParameterFreeOutcomes.Reset();
+			}
+		}
+	}
+
+	if (Visitor)
+	{
+		Visitor(Frame.Property, Frame.Value);
+	}
+}
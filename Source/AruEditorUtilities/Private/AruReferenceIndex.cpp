@@ -0,0 +1,439 @@
+﻿#include "AruReferenceIndex.h"
+#include "AruFunctionLibrary.h"
+#include "AruPropertyTraversal.h"
+#include "GameplayTagContainer.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/Blueprint.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "UObject/ObjectSaveContext.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruReferenceIndex)
+
+namespace Aru::ReferenceIndex
+{
+	// Bumped whenever the file layout or the indexed values change, older files are discarded.
+	static constexpr int32 FileVersion = 1;
+
+	// Time spent starting loads and indexing already loaded packages per tick, at least one package is handled per tick regardless.
+	static constexpr double MaxSecondsPerTick = 0.01;
+
+	static constexpr int32 MaxLoadsInFlight = 8;
+
+	// Packages loaded for indexing aren't referenced by anything afterwards, they are released by collecting garbage this often.
+	static constexpr int32 PackagesPerGC = 64;
+
+	static uint64 HashValue(const FStringView InValue)
+	{
+		const FString LowerValue = FString{InValue}.ToLower();
+		return CityHash64(reinterpret_cast<const char*>(*LowerValue), LowerValue.Len() * sizeof(TCHAR));
+	}
+
+	/** The text a property value is indexed by, false for values that aren't indexed. */
+	static bool GetIndexedText(const FProperty* InProperty, const void* InValue, FString& OutText)
+	{
+		if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(InProperty))
+		{
+			// Read as a path, getting the object would load it.
+			OutText = SoftObjectProperty->GetPropertyValue(InValue).ToSoftObjectPath().ToString();
+		}
+		else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(InProperty))
+		{
+			const UObject* Object = ObjectProperty->GetObjectPropertyValue(InValue);
+			OutText = Object != nullptr ? Object->GetPathName() : FString{};
+		}
+		else if (const FNameProperty* NameProperty = CastField<FNameProperty>(InProperty))
+		{
+			const FName Name = NameProperty->GetPropertyValue(InValue);
+			OutText = Name.IsNone() ? FString{} : Name.ToString();
+		}
+		else if (const FStrProperty* StrProperty = CastField<FStrProperty>(InProperty))
+		{
+			OutText = StrProperty->GetPropertyValue(InValue);
+		}
+		else if (const FTextProperty* TextProperty = CastField<FTextProperty>(InProperty))
+		{
+			OutText = TextProperty->GetPropertyValue(InValue).ToString();
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty))
+		{
+			if (StructProperty->Struct == FGameplayTag::StaticStruct())
+			{
+				OutText = static_cast<const FGameplayTag*>(InValue)->ToString();
+			}
+			else if (StructProperty->Struct == FGameplayTagContainer::StaticStruct())
+			{
+				// Indexed as one entry per tag by the caller.
+				return false;
+			}
+			else if (StructProperty->Struct == TBaseStructure<FSoftObjectPath>::Get())
+			{
+				OutText = static_cast<const FSoftObjectPath*>(InValue)->ToString();
+			}
+		}
+
+		return !OutText.IsEmpty();
+	}
+}
+
+void UAruReferenceIndexSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadIndex();
+
+	UPackage::PackageSavedWithContextEvent.AddUObject(this, &UAruReferenceIndexSubsystem::OnPackageSaved);
+	IAssetRegistry::GetChecked().OnAssetRemoved().AddUObject(this, &UAruReferenceIndexSubsystem::OnAssetRemoved);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UAruReferenceIndexSubsystem::Tick));
+}
+
+void UAruReferenceIndexSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	UPackage::PackageSavedWithContextEvent.RemoveAll(this);
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetRemoved().RemoveAll(this);
+	}
+
+	if (bIndexDirty)
+	{
+		SaveIndex();
+	}
+
+	Super::Deinitialize();
+}
+
+void UAruReferenceIndexSubsystem::StartIndexing(const TArray<FString>& InPackagePaths)
+{
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	for (const FString& PackagePath : InPackagePaths)
+	{
+		Filter.PackagePaths.Add(FName{PackagePath});
+	}
+
+	TArray<FAssetData> Assets;
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.GetAssets(Filter, Assets);
+	for (const FAssetData& Asset : Assets)
+	{
+		if (const FPackageRecord* Record = Packages.Find(Asset.PackageName))
+		{
+			const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Asset.PackageName);
+			if (PackageData.IsSet() && PackageData->GetPackageSavedHash() == Record->SavedHash)
+			{
+				continue;
+			}
+		}
+
+		EnqueuePackage(Asset.PackageName);
+	}
+}
+
+void UAruReferenceIndexSubsystem::StopIndexing()
+{
+	PendingPackages.Reset();
+	PendingPackageSet.Reset();
+}
+
+TArray<FAruIndexedReference> UAruReferenceIndexSubsystem::FindReferencesToObject(const UObject* InObject) const
+{
+	if (InObject == nullptr)
+	{
+		return {};
+	}
+
+	return FindReferencesToValue(InObject->GetPathName());
+}
+
+TArray<FAruIndexedReference> UAruReferenceIndexSubsystem::FindReferencesToValue(const FString& InValue) const
+{
+	TArray<FAruIndexedReference> References;
+	if (InValue.IsEmpty())
+	{
+		return References;
+	}
+
+	const uint64 ValueHash = Aru::ReferenceIndex::HashValue(InValue);
+	TArray<FName, TInlineAllocator<16>> PackageNames;
+	PackagesByValue.MultiFind(ValueHash, PackageNames);
+	for (const FName PackageName : PackageNames)
+	{
+		const FPackageRecord& Record = Packages.FindChecked(PackageName);
+		for (const FIndexEntry& Entry : Record.Entries)
+		{
+			if (Entry.ValueHash == ValueHash)
+			{
+				References.Add({FSoftObjectPath{Record.AssetPath}, Entry.PropertyPath});
+			}
+		}
+	}
+	return References;
+}
+
+TArray<FSoftObjectPath> UAruReferenceIndexSubsystem::FindAssetsReferencingValue(const FString& InValue) const
+{
+	TArray<FSoftObjectPath> Assets;
+	if (InValue.IsEmpty())
+	{
+		return Assets;
+	}
+
+	TArray<FName, TInlineAllocator<16>> PackageNames;
+	PackagesByValue.MultiFind(Aru::ReferenceIndex::HashValue(InValue), PackageNames);
+	for (const FName PackageName : PackageNames)
+	{
+		Assets.Add(FSoftObjectPath{Packages.FindChecked(PackageName).AssetPath});
+	}
+	return Assets;
+}
+
+bool UAruReferenceIndexSubsystem::Tick(float InDeltaTime)
+{
+	// Waits for the loads of the batch to finish, they would be flushed by the collection otherwise.
+	if (NumLoadedSinceGC >= Aru::ReferenceIndex::PackagesPerGC && NumLoadsInFlight == 0)
+	{
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		NumLoadedSinceGC = 0;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + Aru::ReferenceIndex::MaxSecondsPerTick;
+	while (!PendingPackages.IsEmpty()
+		&& NumLoadsInFlight < Aru::ReferenceIndex::MaxLoadsInFlight
+		&& NumLoadedSinceGC + NumLoadsInFlight < Aru::ReferenceIndex::PackagesPerGC)
+	{
+		const FName PackageName = PendingPackages.Pop(EAllowShrinking::No);
+		PendingPackageSet.Remove(PackageName);
+
+		// Packages already in memory, e.g. open in an editor or just saved, are indexed right away.
+		if (FindPackage(nullptr, *PackageName.ToString()) != nullptr)
+		{
+			IndexPackage(PackageName);
+		}
+		else
+		{
+			++NumLoadsInFlight;
+			LoadPackageAsync(
+				PackageName.ToString(),
+				FLoadPackageAsyncDelegate::CreateUObject(this, &UAruReferenceIndexSubsystem::OnPackageLoaded));
+		}
+
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+
+	// Written once the queue drained rather than per asset, a full run would rewrite the file thousands of times.
+	if (!IsIndexing() && bIndexDirty)
+	{
+		bIndexDirty = !SaveIndex();
+	}
+	return true;
+}
+
+void UAruReferenceIndexSubsystem::OnPackageLoaded(const FName& InPackageName, UPackage* InPackage, EAsyncLoadingResult::Type InResult)
+{
+	--NumLoadsInFlight;
+	++NumLoadedSinceGC;
+	if (InResult != EAsyncLoadingResult::Succeeded || InPackage == nullptr)
+	{
+		RemoveRecord(InPackageName);
+		return;
+	}
+
+	IndexPackage(InPackageName);
+}
+
+void UAruReferenceIndexSubsystem::IndexPackage(const FName InPackageName)
+{
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPackageName(InPackageName, Assets);
+	const FAssetData* PrimaryAsset = Assets.FindByPredicate([](const FAssetData& Asset) { return Asset.IsUAsset(); });
+	if (PrimaryAsset == nullptr)
+	{
+		RemoveRecord(InPackageName);
+		return;
+	}
+
+	// Never loads, the package was loaded asynchronously or already was in memory.
+	UObject* Asset = PrimaryAsset->FastGetAsset(false);
+	if (Asset == nullptr)
+	{
+		RemoveRecord(InPackageName);
+		return;
+	}
+
+	FPackageRecord Record;
+	Record.AssetPath = PrimaryAsset->GetSoftObjectPath().ToString();
+	if (const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(InPackageName))
+	{
+		Record.SavedHash = PackageData->GetPackageSavedHash();
+	}
+
+	IndexObject(Asset, Record);
+	AddRecord(InPackageName, MoveTemp(Record));
+}
+
+void UAruReferenceIndexSubsystem::IndexObject(UObject* InAsset, FPackageRecord& OutRecord) const
+{
+	UObject* ObjectToIndex = InAsset;
+	UClass* ClassToIndex = InAsset->GetClass();
+	if (const UBlueprint* BlueprintAsset = Cast<UBlueprint>(InAsset))
+	{
+		ClassToIndex = BlueprintAsset->GeneratedClass;
+		ObjectToIndex = ClassToIndex != nullptr ? ClassToIndex->GetDefaultObject() : nullptr;
+	}
+
+	if (ObjectToIndex == nullptr)
+	{
+		return;
+	}
+
+	// References are recorded where they are held, the referenced objects belong to their own entries.
+	FAruProcessConfig Config;
+	Config.bOnlyTraverseOwnedObjects = true;
+	Config.TraversalPolicy.bFollowExternalReferences = false;
+
+	static const TArray<FAruActionDefinition> NoActions;
+	FAruProcessingState State{NoActions, Config};
+	State.RootObject = ObjectToIndex;
+	State.MarkVisited(ObjectToIndex, Config.MaxSearchDepth);
+
+	const auto AddEntry = [&OutRecord](const FString& InText)
+	{
+		OutRecord.Entries.Add({Aru::ReferenceIndex::HashValue(InText), FAruPropertyPath::GetCurrent()->ToString()});
+	};
+
+	FAruPropertyTraversal Traversal{State};
+	Traversal.SetVisitor([&AddEntry](const FProperty* InProperty, const void* InValue)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+		if (StructProperty != nullptr && StructProperty->Struct == FGameplayTagContainer::StaticStruct())
+		{
+			for (const FGameplayTag& Tag : *static_cast<const FGameplayTagContainer*>(InValue))
+			{
+				AddEntry(Tag.ToString());
+			}
+			return;
+		}
+
+		FString Text;
+		if (Aru::ReferenceIndex::GetIndexedText(InProperty, InValue, Text))
+		{
+			AddEntry(Text);
+		}
+	});
+	Traversal.AddProperties(ClassToIndex, ObjectToIndex, Config.MaxSearchDepth);
+	Traversal.Run();
+}
+
+void UAruReferenceIndexSubsystem::AddRecord(const FName InPackageName, FPackageRecord&& InRecord)
+{
+	RemoveRecord(InPackageName);
+
+	for (const FIndexEntry& Entry : InRecord.Entries)
+	{
+		PackagesByValue.AddUnique(Entry.ValueHash, InPackageName);
+	}
+	Packages.Add(InPackageName, MoveTemp(InRecord));
+	bIndexDirty = true;
+}
+
+void UAruReferenceIndexSubsystem::RemoveRecord(const FName InPackageName)
+{
+	FPackageRecord Record;
+	if (!Packages.RemoveAndCopyValue(InPackageName, Record))
+	{
+		return;
+	}
+
+	for (const FIndexEntry& Entry : Record.Entries)
+	{
+		PackagesByValue.Remove(Entry.ValueHash, InPackageName);
+	}
+	bIndexDirty = true;
+}
+
+void UAruReferenceIndexSubsystem::EnqueuePackage(const FName InPackageName)
+{
+	bool bAlreadyPending = false;
+	PendingPackageSet.Add(InPackageName, &bAlreadyPending);
+	if (!bAlreadyPending)
+	{
+		PendingPackages.Add(InPackageName);
+	}
+}
+
+void UAruReferenceIndexSubsystem::OnPackageSaved(const FString& InFilename, UPackage* InPackage, FObjectPostSaveContext InContext)
+{
+	// Only packages the index already covers are kept up to date, the rest is up to StartIndexing.
+	if (InPackage == nullptr || InContext.IsProceduralSave() || !Packages.Contains(InPackage->GetFName()))
+	{
+		return;
+	}
+
+	// Indexed on a later tick, once the asset registry caught up with the new saved hash.
+	EnqueuePackage(InPackage->GetFName());
+}
+
+void UAruReferenceIndexSubsystem::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	RemoveRecord(InAssetData.PackageName);
+}
+
+bool UAruReferenceIndexSubsystem::LoadIndex()
+{
+	const TUniquePtr<FArchive> FileReader{IFileManager::Get().CreateFileReader(*GetIndexFilename())};
+	if (!FileReader.IsValid())
+	{
+		return false;
+	}
+
+	FNameAsStringProxyArchive Ar{*FileReader};
+	int32 Version = 0;
+	Ar << Version;
+	if (Version != Aru::ReferenceIndex::FileVersion)
+	{
+		return false;
+	}
+
+	TMap<FName, FPackageRecord> LoadedPackages;
+	Ar << LoadedPackages;
+	if (Ar.IsError())
+	{
+		return false;
+	}
+
+	for (TPair<FName, FPackageRecord>& Package : LoadedPackages)
+	{
+		AddRecord(Package.Key, MoveTemp(Package.Value));
+	}
+	bIndexDirty = false;
+	return true;
+}
+
+bool UAruReferenceIndexSubsystem::SaveIndex()
+{
+	const TUniquePtr<FArchive> FileWriter{IFileManager::Get().CreateFileWriter(*GetIndexFilename())};
+	if (!FileWriter.IsValid())
+	{
+		return false;
+	}
+
+	FNameAsStringProxyArchive Ar{*FileWriter};
+	int32 Version = Aru::ReferenceIndex::FileVersion;
+	Ar << Version;
+	Ar << Packages;
+	return FileWriter->Close();
+}
+
+FString UAruReferenceIndexSubsystem::GetIndexFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("AruEditorUtilities") / TEXT("ReferenceIndex.bin");
+}
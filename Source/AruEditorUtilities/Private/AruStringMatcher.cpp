@@ -0,0 +1,138 @@
+﻿#include "AruStringMatcher.h"
+#include "AruFunctionLibrary.h"
+
+FAruStringPatterns FAruStringPatterns::Compile(TConstArrayView<FString> InPatterns, const FAruStringMatchOptions& InOptions)
+{
+	FAruStringPatterns Compiled;
+	Compiled.Options = InOptions;
+	for (const FString& Pattern : InPatterns)
+	{
+		if (Pattern.IsEmpty())
+		{
+			continue;
+		}
+
+		FPattern& CompiledPattern = Compiled.Patterns.AddDefaulted_GetRef();
+		switch (InOptions.PatternType)
+		{
+		case EAruStringPatternType::Plain:
+			CompiledPattern.Text = Pattern;
+			break;
+		case EAruStringPatternType::Wildcard:
+			// Matching anywhere is matching the whole value with any text around the pattern.
+			CompiledPattern.Text = InOptions.bWholeString ? Pattern : FString::Printf(TEXT("*%s*"), *Pattern);
+			break;
+		case EAruStringPatternType::Regex:
+			CompiledPattern.Text = InOptions.bWholeString ? FString::Printf(TEXT("^(?:%s)$"), *Pattern) : Pattern;
+			CompiledPattern.Regex.Emplace(
+				CompiledPattern.Text,
+				InOptions.bCaseSensitive ? ERegexPatternFlags::None : ERegexPatternFlags::CaseInsensitive);
+			break;
+		}
+	}
+	return Compiled;
+}
+
+bool FAruStringPatterns::Matches(const FString& InValue) const
+{
+	const ESearchCase::Type SearchCase = Options.bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
+	for (const FPattern& Pattern : Patterns)
+	{
+		bool bMatched = false;
+		switch (Options.PatternType)
+		{
+		case EAruStringPatternType::Plain:
+			bMatched = Options.bWholeString ? InValue.Equals(Pattern.Text, SearchCase) : InValue.Contains(Pattern.Text, SearchCase);
+			break;
+		case EAruStringPatternType::Wildcard:
+			bMatched = InValue.MatchesWildcard(Pattern.Text, SearchCase);
+			break;
+		case EAruStringPatternType::Regex:
+		{
+			FRegexMatcher Matcher{Pattern.Regex.GetValue(), InValue};
+			bMatched = Matcher.FindNext();
+			break;
+		}
+		}
+
+		if (bMatched)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const FAruStringPatterns& FAruStringMatcher::Get(
+	const FInstancedPropertyBag& InParameters,
+	const FString& InSource,
+	TConstArrayView<FString> InAdditionalSources,
+	const FAruStringMatchOptions& InOptions) const
+{
+	for (const TPair<const FInstancedPropertyBag*, FAruStringPatterns>& Entry : Entries)
+	{
+		if (Entry.Key == &InParameters)
+		{
+			return Entry.Value;
+		}
+	}
+
+	TArray<FString, TInlineAllocator<4>> ResolvedSources;
+	ResolvedSources.Add(UAruFunctionLibrary::ResolveParameterizedString(InParameters, InSource));
+	for (const FString& Source : InAdditionalSources)
+	{
+		ResolvedSources.Add(UAruFunctionLibrary::ResolveParameterizedString(InParameters, Source));
+	}
+	return Entries.Emplace_GetRef(&InParameters, FAruStringPatterns::Compile(ResolvedSources, InOptions)).Value;
+}
+
+bool FAruNameMatcher::Matches(const FInstancedPropertyBag& InParameters, const FName InName, const FString& InSource, const FAruStringMatchOptions& InOptions) const
+{
+	FEntry& Entry = FindOrAddEntry(InParameters, InSource, InOptions);
+	if (Entry.bMatchExactName)
+	{
+		if (Entry.ExactName.IsNone() && !Entry.ExactSource.IsEmpty())
+		{
+			Entry.ExactName = FName{*Entry.ExactSource, FNAME_Find};
+		}
+		return !Entry.ExactName.IsNone() && InName == Entry.ExactName;
+	}
+
+	if (const bool* Outcome = Entry.Outcomes.Find(InName))
+	{
+		return *Outcome;
+	}
+	return Entry.Outcomes.Add(InName, Entry.Patterns.Matches(InName.ToString()));
+}
+
+bool FAruNameMatcher::Matches(const FInstancedPropertyBag& InParameters, const FString& InName, const FString& InSource, const FAruStringMatchOptions& InOptions) const
+{
+	return FindOrAddEntry(InParameters, InSource, InOptions).Patterns.Matches(InName);
+}
+
+FAruNameMatcher::FEntry& FAruNameMatcher::FindOrAddEntry(const FInstancedPropertyBag& InParameters, const FString& InSource, const FAruStringMatchOptions& InOptions) const
+{
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Parameters == &InParameters)
+		{
+			return Entry;
+		}
+	}
+
+	FAruStringMatchOptions Options = InOptions;
+	Options.bCaseSensitive = false;
+
+	const FString ResolvedSource = UAruFunctionLibrary::ResolveParameterizedString(InParameters, InSource);
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Parameters = &InParameters;
+	Entry.Patterns = FAruStringPatterns::Compile(MakeArrayView(&ResolvedSource, 1), Options);
+	if (Options.PatternType == EAruStringPatternType::Plain && Options.bWholeString)
+	{
+		// Only looked up, a name that isn't in the name table yet can't be the name of anything so far.
+		Entry.bMatchExactName = true;
+		Entry.ExactSource = ResolvedSource;
+		Entry.ExactName = ResolvedSource.IsEmpty() ? FName{} : FName{*ResolvedSource, FNAME_Find};
+	}
+	return Entry;
+}
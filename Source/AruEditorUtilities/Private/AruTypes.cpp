@@ -1,6 +1,60 @@
 ﻿#include "AruTypes.h"
+#include "AruFunctionLibrary.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruTypes)
 
+const FString& FAruResolvedString::Resolve(const FInstancedPropertyBag& InParameters, const FString& InSource) const
+{
+	if (!UAruFunctionLibrary::IsParameterizedString(InSource))
+	{
+		return InSource;
+	}
+
+	for (const TPair<const FInstancedPropertyBag*, FString>& Entry : Entries)
+	{
+		if (Entry.Key == &InParameters)
+		{
+			return Entry.Value;
+		}
+	}
+	return Entries.Emplace_GetRef(&InParameters, UAruFunctionLibrary::ResolveParameterizedString(InParameters, InSource)).Value;
+}
+
+void FAruFilter::IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const
+{
+	if (InElementProperty == nullptr || InValues == nullptr)
+	{
+		return;
+	}
+
+	const int32 Stride = InElementProperty->GetSize();
+	for (int32 Index = 0; Index < InNum; ++Index)
+	{
+		if (InOutMatches[Index] && !IsConditionMet(InElementProperty, static_cast<const uint8*>(InValues) + Index * Stride, InParameters))
+		{
+			InOutMatches[Index] = false;
+		}
+	}
+}
+
+int32 FAruPredicate::ExecuteBatch(const FProperty* InElementProperty, void* InValues, const int32 InNum, const TBitArray<>& InMatches, const FInstancedPropertyBag& InParameters) const
+{
+	if (InElementProperty == nullptr || InValues == nullptr)
+	{
+		return 0;
+	}
+
+	int32 NumExecuted = 0;
+	const int32 Stride = InElementProperty->GetSize();
+	for (int32 Index = 0; Index < InNum; ++Index)
+	{
+		if (InMatches[Index] && Execute(InElementProperty, static_cast<uint8*>(InValues) + Index * Stride, InParameters))
+		{
+			++NumExecuted;
+		}
+	}
+	return NumExecuted;
+}
+
 bool FAruActionDefinition::Invoke(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
 {
 	if (InProperty == nullptr || InValue == nullptr)
@@ -8,14 +62,28 @@ bool FAruActionDefinition::Invoke(const FProperty* InProperty, void* InValue, co
 		return false;
 	}
 
+	return AreConditionsMet(InProperty, InValue, InParameters) && ExecutePredicates(InProperty, InValue, InParameters);
+}
+
+bool FAruActionDefinition::AreConditionsMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, const EAruConditionScope InScope) const
+{
 	for (auto& Condition : ForEachCondition())
 	{
+		if (InScope != EAruConditionScope::All && Condition.DependsOnParameters() != (InScope == EAruConditionScope::Parameterized))
+		{
+			continue;
+		}
+
 		if (!Condition.IsConditionMet(InProperty, InValue, InParameters))
 		{
 			return false;
 		}
 	}
+	return true;
+}
 
+bool FAruActionDefinition::ExecutePredicates(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
+{
 	bool bExecutedSuccessfully = false;
 	for (auto& Predicate : ForEachPredicates())
 	{
@@ -23,3 +91,86 @@ bool FAruActionDefinition::Invoke(const FProperty* InProperty, void* InValue, co
 	}
 	return bExecutedSuccessfully;
 }
+
+bool FAruActionDefinition::InvokeBatch(const FProperty* InElementProperty, void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters) const
+{
+	if (InElementProperty == nullptr || InValues == nullptr || InNum <= 0)
+	{
+		return false;
+	}
+
+	TBitArray<> Matches;
+	return AreConditionsMetBatch(InElementProperty, InValues, InNum, InParameters, Matches)
+		&& ExecutePredicatesBatch(InElementProperty, InValues, InNum, Matches, InParameters) > 0;
+}
+
+bool FAruActionDefinition::AreConditionsMetBatch(
+	const FProperty* InElementProperty,
+	const void* InValues,
+	const int32 InNum,
+	const FInstancedPropertyBag& InParameters,
+	TBitArray<>& OutMatches) const
+{
+	OutMatches.Init(true, InNum);
+	for (auto& Condition : ForEachCondition())
+	{
+		Condition.IsConditionMetBatch(InElementProperty, InValues, InNum, InParameters, OutMatches);
+		if (OutMatches.Find(true) == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 FAruActionDefinition::ExecutePredicatesBatch(
+	const FProperty* InElementProperty,
+	void* InValues,
+	const int32 InNum,
+	const TBitArray<>& InMatches,
+	const FInstancedPropertyBag& InParameters) const
+{
+	int32 NumChanged = 0;
+	for (auto& Predicate : ForEachPredicates())
+	{
+		NumChanged += Predicate.ExecuteBatch(InElementProperty, InValues, InNum, InMatches, InParameters);
+	}
+	return NumChanged;
+}
+
+void FAruActionDefinition::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	for (auto& Condition : ForEachCondition())
+	{
+		Condition.BeginProcessing(InParameters);
+	}
+
+	for (auto& Predicate : ForEachPredicates())
+	{
+		Predicate.BeginProcessing(InParameters);
+	}
+}
+
+bool FAruActionDefinition::DependsOnContext() const
+{
+	for (auto& Condition : ForEachCondition())
+	{
+		if (Condition.DependsOnContext())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FAruActionDefinition::CanApplyTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	for (auto& Condition : ForEachCondition())
+	{
+		if (!Condition.CanBeMetBy(InFieldClass, InStructType))
+		{
+			return false;
+		}
+	}
+	return true;
+}
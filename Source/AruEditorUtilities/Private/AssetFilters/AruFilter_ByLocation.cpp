@@ -0,0 +1,62 @@
+﻿#include "AssetFilters/AruFilter_ByLocation.h"
+#include "AruFunctionLibrary.h"
+#include "AruPropertyPath.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_ByLocation)
+
+#define LOCTEXT_NAMESPACE "FAruEditorUtilitiesModule"
+
+void FAruFilter_ByPropertyLocation::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	ResolvedLocations.Reset();
+	CompiledLocations.Reset();
+}
+
+bool FAruFilter_ByPropertyLocation::DependsOnParameters() const
+{
+	return UAruFunctionLibrary::IsParameterizedString(PropertyLocation);
+}
+
+bool FAruFilter_ByPropertyLocation::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr)
+	{
+		return bInverseCondition;
+	}
+
+	const FString& ResolvedLocation = ResolvedLocations.Resolve(InParameters, PropertyLocation);
+	const FAruPropertyQuery* CompiledLocation = CompiledLocations.Find(ResolvedLocation);
+	if (CompiledLocation == nullptr)
+	{
+		TOptional<FAruPropertyQuery> Query = FAruPropertyQuery::Compile(ResolvedLocation);
+		CompiledLocation = &CompiledLocations.Add(ResolvedLocation, Query.IsSet() ? MoveTemp(Query.GetValue()) : FAruPropertyQuery{});
+
+		if (CompiledLocation->IsEmpty())
+		{
+			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+				FText::Format(
+					LOCTEXT(
+						"InvalidPropertyLocation",
+						"[{0}][{1}]Invalid property location:'{2}'."),
+					FText::FromString(GetCompactName()),
+					FText::FromString(Aru::ProcessResult::Failed),
+					FText::FromString(ResolvedLocation)
+				));
+		}
+	}
+
+	if (CompiledLocation->IsEmpty())
+	{
+		return bInverseCondition;
+	}
+
+	// Only the property the traversal is visiting has a known location, e.g. not the items a predicate iterates over.
+	const TOptional<FAruPropertyPath> Path = FAruPropertyPath::GetCurrent();
+	if (!Path.IsSet() || Path->GetLeafProperty() != InProperty)
+	{
+		return bInverseCondition;
+	}
+
+	return CompiledLocation->Matches(Path.GetValue(), bIncludeNestedProperties) ^ bInverseCondition;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,7 +1,28 @@
 ﻿#include "AssetFilters/AruFilter_ByName.h"
 #include "AruFunctionLibrary.h"
+#include "Misc/PackageName.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_ByName)
 
+bool FAruFilter_ByName::DependsOnParameters() const
+{
+	return UAruFunctionLibrary::IsParameterizedString(PropertyName);
+}
+
+void FAruFilter_ByName::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Matcher.Reset();
+	DisplayNames.Reset();
+}
+
+const FString& FAruFilter_ByName::GetDisplayName(const FProperty* InProperty) const
+{
+	if (const FString* DisplayName = DisplayNames.Find(InProperty))
+	{
+		return *DisplayName;
+	}
+	return DisplayNames.Add(InProperty, InProperty->GetDisplayNameText().ToString());
+}
+
 bool FAruFilter_ByName::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
 	if (InProperty == nullptr)
@@ -9,17 +30,24 @@ bool FAruFilter_ByName::IsConditionMet(const FProperty* InProperty, const void*
 		return bInverseCondition;
 	}
 
-	const FString&& ResolvedPropertyName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, PropertyName);
-	if (CompareOp == EAruNameCompareOp::MatchAll)
-	{
-		return (ResolvedPropertyName == InProperty->GetName()
-			 || ResolvedPropertyName == InProperty->GetDisplayNameText().ToString()) ^ bInverseCondition;
-	}
-	else
-	{
-		return (InProperty->GetName().Contains(ResolvedPropertyName)
-			 || InProperty->GetDisplayNameText().ToString().Contains(ResolvedPropertyName)) ^ bInverseCondition;
-	}
+	const FAruStringMatchOptions Options{PatternType, CompareOp == EAruNameCompareOp::MatchAll};
+	return (Matcher.Matches(InParameters, InProperty->GetFName(), PropertyName, Options)
+		 || Matcher.Matches(InParameters, GetDisplayName(InProperty), PropertyName, Options)) ^ bInverseCondition;
+}
+
+bool FAruFilter_ByObjectName::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return UAruFunctionLibrary::IsReferenceType(InFieldClass, InStructType);
+}
+
+bool FAruFilter_ByObjectName::DependsOnParameters() const
+{
+	return UAruFunctionLibrary::IsParameterizedString(ObjectName);
+}
+
+void FAruFilter_ByObjectName::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Matcher.Reset();
 }
 
 bool FAruFilter_ByObjectName::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
@@ -29,25 +57,31 @@ bool FAruFilter_ByObjectName::IsConditionMet(const FProperty* InProperty, const
 		return bInverseCondition;
 	}
 
-	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
-	if (ObjectProperty == nullptr)
+	const FAruStringMatchOptions Options{PatternType, CompareOp == EAruNameCompareOp::MatchAll};
+	if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty))
 	{
-		return bInverseCondition;
+		const UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
+		if (ObjectPtr == nullptr)
+		{
+			return bInverseCondition;
+		}
+		return Matcher.Matches(InParameters, ObjectPtr->GetFName(), ObjectName, Options) ^ bInverseCondition;
 	}
 
-	UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
-	if (ObjectPtr == nullptr)
+	// Soft references are matched by the name in their path and never loaded.
+	FSoftObjectPath ReferencedPath;
+	if (!UAruFunctionLibrary::GetReferencedPath(InProperty, InValue, ReferencedPath) || ReferencedPath.IsNull())
 	{
 		return bInverseCondition;
 	}
 
-	const FString&& ResolvedObjectName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ObjectName);
-	if (CompareOp == EAruNameCompareOp::MatchAll)
+	// The path of a top level asset holds its name already, only subobjects need their name cut from the sub path.
+	if (ReferencedPath.GetSubPathString().IsEmpty())
 	{
-		return (ResolvedObjectName == ObjectPtr->GetName()) ^ bInverseCondition;
-	}
-	else
-	{
-		return (ObjectPtr->GetName().Contains(ResolvedObjectName)) ^ bInverseCondition;
+		return Matcher.Matches(InParameters, ReferencedPath.GetAssetFName(), ObjectName, Options) ^ bInverseCondition;
 	}
+
+	// Matched as a string, making an FName of every subobject name would grow the name table.
+	const FString SubObjectName = FPackageName::ObjectPathToObjectName(ReferencedPath.GetSubPathString());
+	return Matcher.Matches(InParameters, SubObjectName, ObjectName, Options) ^ bInverseCondition;
 }
@@ -4,6 +4,16 @@
 
 #define LOCTEXT_NAMESPACE "FAruEditorUtilitiesModule"
 
+bool FAruFilter_ByAssetPath::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return UAruFunctionLibrary::IsReferenceType(InFieldClass, InStructType);
+}
+
+bool FAruFilter_ByAssetPath::DependsOnParameters() const
+{
+	return MatchingContexts.ContainsByPredicate(&UAruFunctionLibrary::IsParameterizedString);
+}
+
 bool FAruFilter_ByAssetPath::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
 	if (InProperty == nullptr || InValue == nullptr)
@@ -11,21 +21,21 @@ bool FAruFilter_ByAssetPath::IsConditionMet(const FProperty* InProperty, const v
 		return false;
 	}
 
-	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
-	if (ObjectProperty == nullptr)
+	// Soft references are matched by their path and never loaded.
+	FSoftObjectPath ReferencedPath;
+	if (!UAruFunctionLibrary::GetReferencedPath(InProperty, InValue, ReferencedPath))
 	{
 		return false;
 	}
 
-	UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
-	if (ObjectPtr == nullptr)
+	if (ReferencedPath.IsNull())
 	{
 		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 			FText::Format(
 				LOCTEXT(
 					"Failed to filter by object path",
 					"Failed to filter by object path. Property:{0}'s value is nullptr."),
-					FText::FromString(ObjectProperty->GetName())
+					FText::FromString(InProperty->GetName())
 				)
 			);
 		return false;
@@ -38,19 +48,7 @@ bool FAruFilter_ByAssetPath::IsConditionMet(const FProperty* InProperty, const v
 			return UAruFunctionLibrary::ResolveParameterizedString(InParameters, InStringValue);
 		});
 
-	const FString AssetPath = ObjectPtr->GetPathName();
-	if (AssetPath.IsEmpty())
-	{
-		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
-			FText::Format(
-				LOCTEXT(
-					"Failed to filter by object path",
-					"Failed to filter by object:'{0}''s path. Asset's path is empty."),
-					FText::FromString(ObjectPtr->GetName())
-				)
-			);
-		return false;
-	}
+	const FString AssetPath = ReferencedPath.ToString();
 
 	bool Result = ResolvedMatchingContexts.Num() > 0;
 	for (auto& Context : ResolvedMatchingContexts)
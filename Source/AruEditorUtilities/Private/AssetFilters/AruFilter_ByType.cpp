@@ -1,6 +1,11 @@
 ﻿#include "AssetFilters/AruFilter_ByType.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_ByType)
 
+bool FAruFilter_ByObjectType::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return ObjectType == nullptr || InFieldClass->IsChildOf(FObjectProperty::StaticClass());
+}
+
 bool FAruFilter_ByObjectType::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
 	if (ObjectType == nullptr)
@@ -28,6 +33,11 @@ bool FAruFilter_ByObjectType::IsConditionMet(const FProperty* InProperty, const
 	return ObjectType->IsChildOf(ClassType) ^ bInverseCondition;
 }
 
+bool FAruFilter_ByStructType::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return StructType == nullptr || InFieldClass->IsChildOf(FStructProperty::StaticClass());
+}
+
 bool FAruFilter_ByStructType::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
 	if (StructType == nullptr)
@@ -55,6 +65,11 @@ bool FAruFilter_ByStructType::IsConditionMet(const FProperty* InProperty, const
 	return StructType->IsChildOf(InStructType) ^ bInverseCondition;
 }
 
+bool FAruFilter_ByInstancedStructType::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return StructType == nullptr || InStructType == FInstancedStruct::StaticStruct();
+}
+
 bool FAruFilter_ByInstancedStructType::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
 	if (StructType == nullptr)
@@ -1,7 +1,18 @@
 ﻿#include "AssetFilters/AruFilter_ByValue.h"
+#include "AruActionProgram.h"
 #include "AruFunctionLibrary.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_ByValue)
 
+void FAruFilter_ByNumericValue::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Binding = {};
+}
+
+bool FAruFilter_ByNumericValue::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return InFieldClass->IsChildOf(FNumericProperty::StaticClass());
+}
+
 bool FAruFilter_ByNumericValue::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
 	if (InProperty == nullptr || InValue == nullptr)
@@ -9,46 +20,60 @@ bool FAruFilter_ByNumericValue::IsConditionMet(const FProperty* InProperty, cons
 		return bInverseCondition;
 	}
 
-	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty);
-	if (NumericProperty == nullptr)
+	// The kernel only changes when the property class does, so runs over homogeneous data never rebind.
+	const FFieldClass* FieldClass = InProperty->GetClass();
+	if (FieldClass != Binding.FieldClass)
+	{
+		Aru::Numeric::Bind(FieldClass, Aru::Numeric::ToCompare(CompareOp), ConditionValue, Binding);
+	}
+
+	if (Binding.Kernel == nullptr)
 	{
 		return bInverseCondition;
 	}
 
-	auto CompareValue = [&](const float NumericValue)
+	return Binding.Kernel(InValue, Binding.Operand) ^ bInverseCondition;
+}
+
+bool FAruFilter_ByNumericValue::Lower(FAruProgramBuilder& InBuilder) const
+{
+	InBuilder.CompareNumeric(Aru::Numeric::ToCompare(CompareOp), ConditionValue, bInverseCondition);
+	return true;
+}
+
+void FAruFilter_ByNumericValue::IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const
+{
+	if (InElementProperty == nullptr || InValues == nullptr || InNum > InOutMatches.Num())
 	{
-		if (CompareOp == EAruNumericCompareOp::Equip && FMath::IsNearlyEqual(NumericValue, ConditionValue))
-		{
-			return true;
-		}
-		if (CompareOp == EAruNumericCompareOp::NotEqual && NumericValue != ConditionValue)
-		{
-			return true;
-		}
-		if (CompareOp == EAruNumericCompareOp::GreaterThan && NumericValue > ConditionValue)
-		{
-			return true;
-		}
-		if (CompareOp == EAruNumericCompareOp::LessThan && NumericValue < ConditionValue)
-		{
-			return true;
-		}
-		return false;
-	};
+		return;
+	}
 
-	if (NumericProperty->IsFloatingPoint())
+	const FFieldClass* FieldClass = InElementProperty->GetClass();
+	if (FieldClass != Binding.FieldClass)
 	{
-		const float InFloatValue = NumericProperty->GetFloatingPointPropertyValue(InValue);
-		return CompareValue(InFloatValue) ^ bInverseCondition;
+		Aru::Numeric::Bind(FieldClass, Aru::Numeric::ToCompare(CompareOp), ConditionValue, Binding);
 	}
 
-	if (NumericProperty->IsInteger())
+	if (Binding.BatchKernel == nullptr)
 	{
-		const int InIntegerValue = NumericProperty->GetSignedIntPropertyValue(InValue);
-		return CompareValue(InIntegerValue) ^ bInverseCondition;
+		if (!bInverseCondition)
+		{
+			InOutMatches.SetRange(0, InNum, false);
+		}
+		return;
 	}
 
-	return bInverseCondition;
+	Binding.BatchKernel(InValues, InNum, Binding.Operand, bInverseCondition, InOutMatches);
+}
+
+void FAruFilter_InRange::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Binding = {};
+}
+
+bool FAruFilter_InRange::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return InFieldClass->IsChildOf(FNumericProperty::StaticClass());
 }
 
 bool FAruFilter_InRange::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
@@ -58,25 +83,54 @@ bool FAruFilter_InRange::IsConditionMet(const FProperty* InProperty, const void*
 		return bInverseCondition;
 	}
 
-	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InProperty);
-	if (NumericProperty == nullptr)
+	const FFieldClass* FieldClass = InProperty->GetClass();
+	if (FieldClass != Binding.FieldClass)
+	{
+		Aru::Numeric::Bind(FieldClass, ConditionValue.X, ConditionValue.Y, Binding);
+	}
+
+	if (Binding.Kernel == nullptr)
 	{
 		return bInverseCondition;
 	}
 
-	if (NumericProperty->IsFloatingPoint())
+	return Binding.Kernel(InValue, Binding.Min, Binding.Max) ^ bInverseCondition;
+}
+
+bool FAruFilter_InRange::Lower(FAruProgramBuilder& InBuilder) const
+{
+	InBuilder.CompareRange(ConditionValue.X, ConditionValue.Y, bInverseCondition);
+	return true;
+}
+
+void FAruFilter_InRange::IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const
+{
+	if (InElementProperty == nullptr || InValues == nullptr || InNum > InOutMatches.Num())
+	{
+		return;
+	}
+
+	const FFieldClass* FieldClass = InElementProperty->GetClass();
+	if (FieldClass != Binding.FieldClass)
 	{
-		const float InFloatValue = NumericProperty->GetFloatingPointPropertyValue(InValue);
-		return FMath::IsWithin(InFloatValue, ConditionValue.X, ConditionValue.Y) ^ bInverseCondition;
+		Aru::Numeric::Bind(FieldClass, ConditionValue.X, ConditionValue.Y, Binding);
 	}
 
-	if (NumericProperty->IsInteger())
+	if (Binding.BatchKernel == nullptr)
 	{
-		const int InIntegerValue = NumericProperty->GetSignedIntPropertyValue(InValue);
-		return FMath::IsWithin(InIntegerValue, ConditionValue.X, ConditionValue.Y) ^ bInverseCondition;
+		if (!bInverseCondition)
+		{
+			InOutMatches.SetRange(0, InNum, false);
+		}
+		return;
 	}
 
-	return bInverseCondition;
+	Binding.BatchKernel(InValues, InNum, Binding.Min, Binding.Max, bInverseCondition, InOutMatches);
+}
+
+bool FAruFilter_ByBoolean::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return InFieldClass->IsChildOf(FBoolProperty::StaticClass());
 }
 
 bool FAruFilter_ByBoolean::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
@@ -108,22 +162,108 @@ bool FAruFilter_ByBoolean::IsConditionMet(const FProperty* InProperty, const voi
 	return CompareValue(BooleanProperty->GetPropertyValue(InValue)) ^ bInverseCondition;
 }
 
+bool FAruFilter_ByBoolean::Lower(FAruProgramBuilder& InBuilder) const
+{
+	// "Not" a value is "Is" the other one.
+	InBuilder.CompareBool(CompareOp == EAruBooleanCompareOp::Is ? ConditionValue : !ConditionValue, bInverseCondition);
+	return true;
+}
+
+bool FAruFilter_ByObject::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return UAruFunctionLibrary::IsReferenceType(InFieldClass, InStructType);
+}
+
+void FAruFilter_ByObject::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	ConditionPath.Reset();
+}
+
+const FSoftObjectPath& FAruFilter_ByObject::GetConditionPath() const
+{
+	if (!ConditionPath.IsSet())
+	{
+		ConditionPath = FSoftObjectPath{ConditionValue.Get()};
+	}
+	return ConditionPath.GetValue();
+}
+
 bool FAruFilter_ByObject::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
-	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
-	if (ObjectProperty == nullptr)
+	if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty))
+	{
+		UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
+		return (ObjectPtr == ConditionValue) ^ bInverseCondition;
+	}
+
+	// Soft references are compared by path and never loaded.
+	FSoftObjectPath ReferencedPath;
+	if (!UAruFunctionLibrary::GetReferencedPath(InProperty, InValue, ReferencedPath))
 	{
 		return bInverseCondition;
 	}
 
-	UObject* ObjectPtr = ObjectProperty->GetObjectPropertyValue(InValue);
+	return (ReferencedPath == GetConditionPath()) ^ bInverseCondition;
+}
+
+bool FAruFilter_ByObject::Lower(FAruProgramBuilder& InBuilder) const
+{
+	InBuilder.CompareObject(ConditionValue, bInverseCondition);
+	return true;
+}
+
+bool FAruFilter_ByEnum::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return InFieldClass->IsChildOf(FEnumProperty::StaticClass());
+}
+
+void FAruFilter_ByEnum::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	ResolvedValues.Reset();
+}
+
+const FAruFilter_ByEnum::FResolvedValues& FAruFilter_ByEnum::ResolveValues(const UEnum* InEnum) const
+{
+	for (const FResolvedValues& Resolved : ResolvedValues)
+	{
+		if (Resolved.Enum == InEnum)
+		{
+			return Resolved;
+		}
+	}
+
+	FResolvedValues& Resolved = ResolvedValues.AddDefaulted_GetRef();
+	Resolved.Enum = InEnum;
+
+	auto AddValue = [InEnum, &Resolved](const FString& InName)
+	{
+		const int64 Value = InName.IsEmpty() ? INDEX_NONE : InEnum->GetValueByNameString(InName);
+		if (Value == INDEX_NONE)
+		{
+			return;
+		}
+
+		if (Value >= 0 && Value < 64)
+		{
+			Resolved.ValueMask |= uint64{1} << Value;
+		}
+		else
+		{
+			Resolved.OtherValues.AddUnique(Value);
+		}
+	};
 
-	return (ObjectPtr == ConditionValue) ^ bInverseCondition;
+	AddValue(ConditionValue);
+	for (const FString& AdditionalValue : AdditionalConditionValues)
+	{
+		AddValue(AdditionalValue);
+	}
+	return Resolved;
 }
 
 bool FAruFilter_ByEnum::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
-	if (InProperty == nullptr || ConditionValue.IsEmpty())
+	if (InProperty == nullptr)
 	{
 		return bInverseCondition;
 	}
@@ -146,22 +286,40 @@ bool FAruFilter_ByEnum::IsConditionMet(const FProperty* InProperty, const void*
 		return bInverseCondition;
 	}
 
-	const int64 ConditionEnumValue = EnumType->GetValueByNameString(*ConditionValue);
-	if (ConditionEnumValue == INDEX_NONE)
+	const FResolvedValues& Resolved = ResolveValues(EnumType);
+	if (Resolved.IsEmpty())
 	{
 		return bInverseCondition;
 	}
 
-	const int64 InEnumValue = UnderlyingProperty->GetSignedIntPropertyValue(InValue);
-	return (
-		(CompareOp == EAruBooleanCompareOp::Is && ConditionEnumValue == InEnumValue) ||
-		(CompareOp == EAruBooleanCompareOp::Not && ConditionEnumValue != InEnumValue)
-	) ^ bInverseCondition;
+	const bool bContained = Resolved.Contains(UnderlyingProperty->GetSignedIntPropertyValue(InValue));
+	return (CompareOp == EAruBooleanCompareOp::Is ? bContained : !bContained) ^ bInverseCondition;
+}
+
+bool FAruFilter_ByString::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return InFieldClass->IsChildOf(FStrProperty::StaticClass());
+}
+
+bool FAruFilter_ByString::DependsOnParameters() const
+{
+	return UAruFunctionLibrary::IsParameterizedString(ConditionValue)
+		|| AdditionalConditionValues.ContainsByPredicate(&UAruFunctionLibrary::IsParameterizedString);
+}
+
+void FAruFilter_ByString::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Matcher.Reset();
+}
+
+const FAruStringPatterns& FAruFilter_ByString::GetPatterns(const FInstancedPropertyBag& InParameters) const
+{
+	return Matcher.Get(InParameters, ConditionValue, AdditionalConditionValues, {PatternType, CompareOp == EAruContainerCompareOp::HasAll, bCaseSensitive});
 }
 
 bool FAruFilter_ByString::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
-	if (InProperty == nullptr || ConditionValue.IsEmpty())
+	if (InProperty == nullptr)
 	{
 		return bInverseCondition;
 	}
@@ -178,23 +336,39 @@ bool FAruFilter_ByString::IsConditionMet(const FProperty* InProperty, const void
 		return bInverseCondition;
 	}
 
-	ESearchCase::Type SearchCase = bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
-	const FString&& ResolvedConditionValue = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ConditionValue);
-	if (CompareOp == EAruContainerCompareOp::HasAll)
-	{
-		return InStringValue->Equals(ResolvedConditionValue, SearchCase) ^ bInverseCondition;
-	}
-	else if (CompareOp == EAruContainerCompareOp::HasAny)
+	const FAruStringPatterns& Patterns = GetPatterns(InParameters);
+	if (Patterns.IsEmpty())
 	{
-		return InStringValue->Contains(ResolvedConditionValue, SearchCase) ^ bInverseCondition;
+		return bInverseCondition;
 	}
 
-	return bInverseCondition;
+	return Patterns.Matches(*InStringValue) ^ bInverseCondition;
+}
+
+bool FAruFilter_ByText::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return InFieldClass->IsChildOf(FTextProperty::StaticClass());
+}
+
+bool FAruFilter_ByText::DependsOnParameters() const
+{
+	return UAruFunctionLibrary::IsParameterizedString(ConditionValue)
+		|| AdditionalConditionValues.ContainsByPredicate(&UAruFunctionLibrary::IsParameterizedString);
+}
+
+void FAruFilter_ByText::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Matcher.Reset();
+}
+
+const FAruStringPatterns& FAruFilter_ByText::GetPatterns(const FInstancedPropertyBag& InParameters) const
+{
+	return Matcher.Get(InParameters, ConditionValue, AdditionalConditionValues, {PatternType, CompareOp == EAruContainerCompareOp::HasAll, bCaseSensitive});
 }
 
 bool FAruFilter_ByText::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
 {
-	if (InProperty == nullptr || ConditionValue.IsEmpty())
+	if (InProperty == nullptr)
 	{
 		return bInverseCondition;
 	}
@@ -211,19 +385,244 @@ bool FAruFilter_ByText::IsConditionMet(const FProperty* InProperty, const void*
 		return bInverseCondition;
 	}
 
-	const FString& InStringValue = InTextValue->ToString();
-	ESearchCase::Type SearchCase = bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
-	const FString&& ResolvedConditionValue = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ConditionValue);
-	if (CompareOp == EAruContainerCompareOp::HasAll)
+	const FAruStringPatterns& Patterns = GetPatterns(InParameters);
+	if (Patterns.IsEmpty())
 	{
-		return InStringValue.Equals(ResolvedConditionValue, SearchCase) ^ bInverseCondition;
+		return bInverseCondition;
 	}
-	else if (CompareOp == EAruContainerCompareOp::HasAny)
+
+	// The display string is only referenced, not copied.
+	return Patterns.Matches(InTextValue->ToString()) ^ bInverseCondition;
+}
+
+bool FAruCompiledGameplayTagQuery::Compile(const FGameplayTagQuery& InQuery)
+{
+	Reset();
+	if (InQuery.IsEmpty())
 	{
-		return InStringValue.Contains(ResolvedConditionValue, SearchCase) ^ bInverseCondition;
+		return false;
 	}
 
-	return bInverseCondition;
+	FGameplayTagQueryExpression RootExpression;
+	InQuery.GetQueryExpr(RootExpression);
+
+	// Reserve the root first so it always lives at index 0.
+	Nodes.AddDefaulted();
+	const int32 RootIndex = AddExpression(RootExpression);
+	if (RootIndex == INDEX_NONE)
+	{
+		Reset();
+		return false;
+	}
+
+	Nodes[0] = Nodes[RootIndex];
+	Nodes.RemoveAt(RootIndex);
+	return true;
+}
+
+void FAruCompiledGameplayTagQuery::Reset()
+{
+	Tags.Reset();
+	Nodes.Reset();
+}
+
+int32 FAruCompiledGameplayTagQuery::AddExpression(const FGameplayTagQueryExpression& InExpression)
+{
+	FNode Node;
+	Node.ExprType = InExpression.ExprType;
+
+	if (InExpression.UsesTagSet())
+	{
+		for (const FGameplayTag& Tag : InExpression.TagSet)
+		{
+			int32 TagIndex = Tags.IndexOfByKey(Tag);
+			if (TagIndex == INDEX_NONE)
+			{
+				if (Tags.Num() >= 64)
+				{
+					return INDEX_NONE;
+				}
+				TagIndex = Tags.Add(Tag);
+			}
+			Node.TagMask |= uint64{1} << TagIndex;
+		}
+	}
+	else if (InExpression.UsesExprSet())
+	{
+		// Children are stored contiguously so a node only needs to know where its range starts.
+		Node.FirstChild = Nodes.Num();
+		Node.NumChildren = InExpression.ExprSet.Num();
+		Nodes.AddDefaulted(Node.NumChildren);
+
+		for (int32 Index = 0; Index < InExpression.ExprSet.Num(); ++Index)
+		{
+			const int32 ChildIndex = AddExpression(InExpression.ExprSet[Index]);
+			if (ChildIndex == INDEX_NONE)
+			{
+				return INDEX_NONE;
+			}
+			Nodes[Node.FirstChild + Index] = Nodes[ChildIndex];
+			Nodes.RemoveAt(ChildIndex);
+		}
+	}
+	else
+	{
+		return INDEX_NONE;
+	}
+
+	return Nodes.Add(Node);
+}
+
+bool FAruCompiledGameplayTagQuery::Matches(const FGameplayTag& InTag) const
+{
+	uint64 MatchedMask = 0;
+	uint64 ExactMask = 0;
+	for (int32 Index = 0; Index < Tags.Num(); ++Index)
+	{
+		if (InTag.MatchesTag(Tags[Index]))
+		{
+			MatchedMask |= uint64{1} << Index;
+		}
+		if (InTag.MatchesTagExact(Tags[Index]))
+		{
+			ExactMask |= uint64{1} << Index;
+		}
+	}
+
+	return EvaluateNode(0, MatchedMask, ExactMask);
+}
+
+bool FAruCompiledGameplayTagQuery::Matches(const FGameplayTagContainer& InTags) const
+{
+	uint64 MatchedMask = 0;
+	uint64 ExactMask = 0;
+	for (int32 Index = 0; Index < Tags.Num(); ++Index)
+	{
+		if (InTags.HasTag(Tags[Index]))
+		{
+			MatchedMask |= uint64{1} << Index;
+		}
+		if (InTags.HasTagExact(Tags[Index]))
+		{
+			ExactMask |= uint64{1} << Index;
+		}
+	}
+
+	return EvaluateNode(0, MatchedMask, ExactMask);
+}
+
+bool FAruCompiledGameplayTagQuery::EvaluateNode(const int32 NodeIndex, const uint64 MatchedMask, const uint64 ExactMask) const
+{
+	const FNode& Node = Nodes[NodeIndex];
+	switch (Node.ExprType)
+	{
+	case EGameplayTagQueryExprType::AnyTagsMatch:
+		return (MatchedMask & Node.TagMask) != 0;
+	case EGameplayTagQueryExprType::AllTagsMatch:
+		return (MatchedMask & Node.TagMask) == Node.TagMask;
+	case EGameplayTagQueryExprType::NoTagsMatch:
+		return (MatchedMask & Node.TagMask) == 0;
+	case EGameplayTagQueryExprType::AnyTagsExactMatch:
+		return (ExactMask & Node.TagMask) != 0;
+	case EGameplayTagQueryExprType::AllTagsExactMatch:
+		return (ExactMask & Node.TagMask) == Node.TagMask;
+	case EGameplayTagQueryExprType::AnyExprMatch:
+		for (int32 Index = Node.FirstChild; Index < Node.FirstChild + Node.NumChildren; ++Index)
+		{
+			if (EvaluateNode(Index, MatchedMask, ExactMask))
+			{
+				return true;
+			}
+		}
+		return false;
+	case EGameplayTagQueryExprType::AllExprMatch:
+		for (int32 Index = Node.FirstChild; Index < Node.FirstChild + Node.NumChildren; ++Index)
+		{
+			if (!EvaluateNode(Index, MatchedMask, ExactMask))
+			{
+				return false;
+			}
+		}
+		return true;
+	case EGameplayTagQueryExprType::NoExprMatch:
+		for (int32 Index = Node.FirstChild; Index < Node.FirstChild + Node.NumChildren; ++Index)
+		{
+			if (EvaluateNode(Index, MatchedMask, ExactMask))
+			{
+				return false;
+			}
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+void FAruFilter_ByGameplayTagContainer::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	bQueryCompiled = false;
+	CompiledQuery.Reset();
+	CachedTagResults.Reset();
+	CachedContainerResults.Reset();
+}
+
+void FAruFilter_ByGameplayTagContainer::CompileQuery() const
+{
+	if (bQueryCompiled)
+	{
+		return;
+	}
+
+	// Queries that can't be flattened keep using FGameplayTagQuery::Matches, results are memoized either way.
+	CompiledQuery.Compile(TagQuery);
+	bQueryCompiled = true;
+}
+
+bool FAruFilter_ByGameplayTagContainer::MatchesTag(const FGameplayTag& InTag) const
+{
+	if (const bool* CachedResult = CachedTagResults.Find(InTag))
+	{
+		return *CachedResult;
+	}
+
+	CompileQuery();
+	const bool bResult = CompiledQuery.IsValid()
+		? CompiledQuery.Matches(InTag)
+		: TagQuery.Matches(FGameplayTagContainer{InTag});
+
+	CachedTagResults.Add(InTag, bResult);
+	return bResult;
+}
+
+bool FAruFilter_ByGameplayTagContainer::MatchesTags(const FGameplayTagContainer& InTags) const
+{
+	uint32 ContainerHash = 0;
+	for (const FGameplayTag& Tag : InTags)
+	{
+		ContainerHash = HashCombineFast(ContainerHash, GetTypeHash(Tag));
+	}
+
+	for (auto It = CachedContainerResults.CreateConstKeyIterator(ContainerHash); It; ++It)
+	{
+		const TPair<FGameplayTagContainer, bool>& CachedResult = It.Value();
+		if (CachedResult.Key == InTags)
+		{
+			return CachedResult.Value;
+		}
+	}
+
+	CompileQuery();
+	const bool bResult = CompiledQuery.IsValid()
+		? CompiledQuery.Matches(InTags)
+		: TagQuery.Matches(InTags);
+
+	CachedContainerResults.Add(ContainerHash, TPair<FGameplayTagContainer, bool>{InTags, bResult});
+	return bResult;
+}
+
+bool FAruFilter_ByGameplayTagContainer::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return InStructType == FGameplayTag::StaticStruct() || InStructType == FGameplayTagContainer::StaticStruct();
 }
 
 bool FAruFilter_ByGameplayTagContainer::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
@@ -253,7 +652,7 @@ bool FAruFilter_ByGameplayTagContainer::IsConditionMet(const FProperty* InProper
 			return bInverseCondition;
 		}
 
-		return TagQuery.Matches(FGameplayTagContainer{*GameplayTagPtr}) ^ bInverseCondition;
+		return MatchesTag(*GameplayTagPtr) ^ bInverseCondition;
 	}
 
 	if (StructType == FGameplayTagContainer::StaticStruct())
@@ -264,7 +663,7 @@ bool FAruFilter_ByGameplayTagContainer::IsConditionMet(const FProperty* InProper
 			return bInverseCondition;
 		}
 
-		return TagQuery.Matches(*GameplayTagsPtr) ^ bInverseCondition;
+		return MatchesTags(*GameplayTagsPtr) ^ bInverseCondition;
 	}
 
 	return bInverseCondition;
@@ -0,0 +1,144 @@
+﻿#include "AssetFilters/AruFilter_Logic.h"
+#include "Algo/StableSort.h"
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AruFilter_Logic)
+
+bool FAruFilter_Group::DependsOnContext() const
+{
+	return GetSortedConditions().ContainsByPredicate([](const FAruFilter* InCondition) { return InCondition->DependsOnContext(); });
+}
+
+bool FAruFilter_Group::DependsOnParameters() const
+{
+	return GetSortedConditions().ContainsByPredicate([](const FAruFilter* InCondition) { return InCondition->DependsOnParameters(); });
+}
+
+int32 FAruFilter_Group::GetEstimatedCost() const
+{
+	// What evaluating every child costs, short-circuiting only ever makes it cheaper.
+	int32 Cost = 0;
+	for (const FAruFilter* Condition : GetSortedConditions())
+	{
+		Cost += Condition->GetEstimatedCost();
+	}
+	return FMath::Max(Cost, 1);
+}
+
+void FAruFilter_Group::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Conditions, InParameters);
+	bSorted = false;
+}
+
+TConstArrayView<const FAruFilter*> FAruFilter_Group::GetSortedConditions() const
+{
+	if (!bSorted)
+	{
+		SortedConditions.Reset(Conditions.Num());
+		for (const TInstancedStruct<FAruFilter>& Condition : Conditions)
+		{
+			if (const FAruFilter* ConditionPtr = Condition.GetPtr<FAruFilter>())
+			{
+				SortedConditions.Add(ConditionPtr);
+			}
+		}
+
+		Algo::StableSortBy(SortedConditions, [](const FAruFilter* InCondition) { return InCondition->GetEstimatedCost(); });
+		bSorted = true;
+	}
+	return SortedConditions;
+}
+
+bool FAruFilter_Any::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	for (const FAruFilter* Condition : GetSortedConditions())
+	{
+		if (Condition->IsConditionMet(InProperty, InValue, InParameters))
+		{
+			return !bInverseCondition;
+		}
+	}
+	return bInverseCondition;
+}
+
+bool FAruFilter_Any::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	return GetSortedConditions().ContainsByPredicate(
+		[InFieldClass, InStructType](const FAruFilter* InCondition) { return InCondition->CanBeMetBy(InFieldClass, InStructType); });
+}
+
+bool FAruFilter_All::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	for (const FAruFilter* Condition : GetSortedConditions())
+	{
+		if (!Condition->IsConditionMet(InProperty, InValue, InParameters))
+		{
+			return bInverseCondition;
+		}
+	}
+	return !bInverseCondition;
+}
+
+bool FAruFilter_All::IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+{
+	for (const FAruFilter* Condition : GetSortedConditions())
+	{
+		if (!Condition->CanBeMetBy(InFieldClass, InStructType))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FAruFilter_All::IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const
+{
+	// Children clearing bits in turn is exactly their conjunction, the inverted form needs the per value fallback.
+	if (bInverseCondition)
+	{
+		FAruFilter::IsConditionMetBatch(InElementProperty, InValues, InNum, InParameters, InOutMatches);
+		return;
+	}
+
+	for (const FAruFilter* Condition : GetSortedConditions())
+	{
+		Condition->IsConditionMetBatch(InElementProperty, InValues, InNum, InParameters, InOutMatches);
+		if (InOutMatches.Find(true) == INDEX_NONE)
+		{
+			return;
+		}
+	}
+}
+
+bool FAruFilter_Not::IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const
+{
+	const FAruFilter* ConditionPtr = Condition.GetPtr<FAruFilter>();
+	if (ConditionPtr == nullptr)
+	{
+		return bInverseCondition;
+	}
+
+	return !ConditionPtr->IsConditionMet(InProperty, InValue, InParameters) ^ bInverseCondition;
+}
+
+bool FAruFilter_Not::DependsOnContext() const
+{
+	const FAruFilter* ConditionPtr = Condition.GetPtr<FAruFilter>();
+	return ConditionPtr != nullptr && ConditionPtr->DependsOnContext();
+}
+
+bool FAruFilter_Not::DependsOnParameters() const
+{
+	const FAruFilter* ConditionPtr = Condition.GetPtr<FAruFilter>();
+	return ConditionPtr != nullptr && ConditionPtr->DependsOnParameters();
+}
+
+int32 FAruFilter_Not::GetEstimatedCost() const
+{
+	const FAruFilter* ConditionPtr = Condition.GetPtr<FAruFilter>();
+	return ConditionPtr != nullptr ? ConditionPtr->GetEstimatedCost() : 1;
+}
+
+void FAruFilter_Not::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Condition, InParameters);
+}
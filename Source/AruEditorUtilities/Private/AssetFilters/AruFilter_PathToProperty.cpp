@@ -43,4 +43,28 @@ bool FAruFilter_PathToProperty::IsConditionMet(const FProperty* InProperty, cons
 	return bInverseCondition;
 }
 
+void FAruFilter_PathToProperty::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Filter, InParameters);
+}
+
+bool FAruFilter_PathToProperty::DependsOnContext() const
+{
+	const FAruFilter* FilterPtr = Filter.GetPtr<FAruFilter>();
+	return FilterPtr != nullptr && FilterPtr->DependsOnContext();
+}
+
+bool FAruFilter_PathToProperty::DependsOnParameters() const
+{
+	const FAruFilter* FilterPtr = Filter.GetPtr<FAruFilter>();
+	return UAruFunctionLibrary::IsParameterizedString(PathToProperty) || (FilterPtr != nullptr && FilterPtr->DependsOnParameters());
+}
+
+int32 FAruFilter_PathToProperty::GetEstimatedCost() const
+{
+	// Splitting, resolving and walking the path on every call.
+	const FAruFilter* FilterPtr = Filter.GetPtr<FAruFilter>();
+	return 8 + (FilterPtr != nullptr ? FilterPtr->GetEstimatedCost() : 0);
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -1,4 +1,5 @@
 ﻿#include "AssetPredicates/AruPredicate_Array.h"
+#include "AruPropertyPath.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Array)
 #define LOCTEXT_NAMESPACE "AruPredicate_Array"
 
@@ -17,7 +18,7 @@ bool FAruPredicate_AddArrayValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not an array."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -47,7 +48,7 @@ bool FAruPredicate_AddArrayValue::Execute(
 					"[{0}][{1}]Map:'{2}'. Malloc memory for element failed."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -132,7 +133,7 @@ bool FAruPredicate_RemoveArrayValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not an array."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -213,7 +214,7 @@ bool FAruPredicate_ModifyArrayValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not an array."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -293,4 +294,21 @@ bool FAruPredicate_ModifyArrayValue::Execute(
 
 	return ModifiedCount > 0;
 }
+
+void FAruPredicate_AddArrayValue::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Predicates, InParameters);
+}
+
+void FAruPredicate_RemoveArrayValue::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Filters, InParameters);
+}
+
+void FAruPredicate_ModifyArrayValue::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Filters, InParameters);
+	Aru::BeginProcessing(Predicates, InParameters);
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
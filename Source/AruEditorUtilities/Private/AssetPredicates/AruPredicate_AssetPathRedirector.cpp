@@ -1,5 +1,10 @@
 ﻿#include "AssetPredicates/AruPredicate_AssetPathRedirector.h"
+#include "AruPropertyPath.h"
 #include "AruFunctionLibrary.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Misc/PackageName.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_AssetPathRedirector)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_AssetPathRedirector"
@@ -14,6 +19,11 @@ bool FAruPredicate_AssetPathRedirector::Execute(
 		return false;
 	}
 
+	if (UAruFunctionLibrary::IsSoftReference(InProperty))
+	{
+		return RedirectSoftReference(InProperty, InValue, InParameters);
+	}
+
 	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(InProperty);
 	if (ObjectProperty == nullptr)
 	{
@@ -24,7 +34,7 @@ bool FAruPredicate_AssetPathRedirector::Execute(
 					"[{0}][{1}]Property:'{1}' is not an uobject."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -45,49 +55,16 @@ bool FAruPredicate_AssetPathRedirector::Execute(
 		return false;
 	}
 
-	TMap<FString, FString> ResolvedReplacementMap;
-	Algo::Transform(
-		ReplacementMap, ResolvedReplacementMap, [&InParameters](const TTuple<FString, FString>& InTuple)
-		{
-			return TTuple<FString, FString>
-			{
-				UAruFunctionLibrary::ResolveParameterizedString(InParameters, InTuple.Key),
-				UAruFunctionLibrary::ResolveParameterizedString(InParameters, InTuple.Value)
-			};
-		});
-
-	TArray<FString> SortedKeys;
-	ResolvedReplacementMap.GetKeys(SortedKeys);
-	SortedKeys.Sort(
-		[](const FString& A, const FString& B)
-		{
-			return A.Len() > B.Len();
-		});
-
-	TArray<FString> PathSegments;
-	ObjectPtr->GetPathName().ParseIntoArray(PathSegments, TEXT("/"), true);
-	for (FString& Segment : PathSegments)
+	const FString NewPath = RedirectPath(ObjectPtr->GetPathName(), InParameters);
+	const FSoftObjectPath TargetAssetPath{NewPath};
+	if (UObject* LoadedAsset = TargetAssetPath.TryLoad())
 	{
-		FString ModifiedSegment = Segment;
-		for (const FString& Key : SortedKeys)
+		// Redirected onto itself, nothing changes.
+		if (LoadedAsset == ObjectPtr)
 		{
-			if (!ModifiedSegment.Contains(Key))
-			{
-				continue;
-			}
-
-			if (const FString* Replacement = ResolvedReplacementMap.Find(Key))
-			{
-				ModifiedSegment = ModifiedSegment.Replace(*Key, **Replacement, ESearchCase::CaseSensitive);
-			}
+			return false;
 		}
-		Segment = ModifiedSegment;
-	}
 
-	FString NewPath = FString::Printf(TEXT("/%s"), *FString::Join(PathSegments, TEXT("/")));
-	const FSoftObjectPath TargetAssetPath{NewPath};
-	if (UObject* LoadedAsset = TargetAssetPath.TryLoad())
-	{
 		if(!LoadedAsset->IsA(ObjectPtr->GetClass()))
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
@@ -97,7 +74,7 @@ bool FAruPredicate_AssetPathRedirector::Execute(
 					"[{0}][{1}]Property:'{2}' object class:{3}, new object class:{4}."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(ObjectPtr->GetClass()?ObjectPtr->GetClass()->GetName():FString{"NULL"}),
 				FText::FromString(LoadedAsset->GetClass()?LoadedAsset->GetClass()->GetName():FString{"NULL"})
 			));
@@ -128,10 +105,237 @@ bool FAruPredicate_AssetPathRedirector::Execute(
 				"[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
 			FText::FromString(GetCompactName()),
 			FText::FromString(Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 			FText::FromString(NewPath)
 		));
 
 	return false;
 }
+
+bool FAruPredicate_AssetPathRedirector::RedirectSoftReference(
+	const FProperty* InProperty,
+	void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	FSoftObjectPath PreviousPath;
+	if (!UAruFunctionLibrary::GetReferencedPath(InProperty, InValue, PreviousPath) || PreviousPath.IsNull())
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"PropertyValueNull",
+					"[{0}][{1}]Property:'{2}' is NULL."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(InProperty->GetName())
+			)
+		);
+		return false;
+	}
+
+	const FString NewPath = RedirectPath(PreviousPath.ToString(), InParameters);
+	const FSoftObjectPath TargetAssetPath{NewPath};
+	if (TargetAssetPath == PreviousPath)
+	{
+		return false;
+	}
+
+	// Both assets are looked up in the asset registry, neither of them gets loaded.
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	bool bTargetFound = false;
+	bool bCompatible = true;
+	FString PreviousClassName;
+	FString TargetClassName;
+	if (IsClassReference(InProperty))
+	{
+		// Soft class paths name the generated class, e.g. '/Game/X.X_C', the registry only knows the blueprint owning it.
+		bTargetFound = DoesClassExist(AssetRegistry, TargetAssetPath);
+		bCompatible = !DoesClassExist(AssetRegistry, PreviousPath) || IsSameOrDerivedClass(AssetRegistry, TargetAssetPath, PreviousPath);
+		PreviousClassName = PreviousPath.ToString();
+		TargetClassName = TargetAssetPath.ToString();
+	}
+	else
+	{
+		const FAssetData TargetAsset = AssetRegistry.GetAssetByObjectPath(TargetAssetPath);
+		const FAssetData PreviousAsset = AssetRegistry.GetAssetByObjectPath(PreviousPath);
+		bTargetFound = TargetAsset.IsValid();
+		bCompatible = !PreviousAsset.IsValid() || IsSameOrDerivedClass(TargetAsset, PreviousAsset);
+		PreviousClassName = PreviousAsset.AssetClassPath.ToString();
+		TargetClassName = TargetAsset.AssetClassPath.ToString();
+	}
+
+	if (!bTargetFound)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"ObjectNotFound",
+					"[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+				FText::FromString(NewPath)
+			));
+		return false;
+	}
+
+	if (!bCompatible)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"ClassTypeMismatch",
+					"[{0}][{1}]Property:'{2}' object class:{3}, new object class:{4}."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+				FText::FromString(PreviousClassName),
+				FText::FromString(TargetClassName)
+			));
+		return false;
+	}
+
+	if (const FSoftObjectProperty* SoftObjectProperty = CastField<FSoftObjectProperty>(InProperty))
+	{
+		SoftObjectProperty->SetPropertyValue(InValue, FSoftObjectPtr{TargetAssetPath});
+	}
+	else
+	{
+		*static_cast<FSoftObjectPath*>(InValue) = TargetAssetPath;
+	}
+
+	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+		FText::Format(
+			LOCTEXT(
+				"OperationSucceed",
+				"[{0}][{1}]Previous asset:'{2}', New asset:'{3}' from '{4}'"),
+			FText::FromString(GetCompactName()),
+			FText::FromString(Aru::ProcessResult::Success),
+			FText::FromString(PreviousPath.GetAssetName()),
+			FText::FromString(TargetAssetPath.GetAssetName()),
+			FText::FromString(NewPath)
+		)
+	);
+	return true;
+}
+
+FString FAruPredicate_AssetPathRedirector::RedirectPath(const FString& InPath, const FInstancedPropertyBag& InParameters) const
+{
+	TMap<FString, FString> ResolvedReplacementMap;
+	Algo::Transform(
+		ReplacementMap, ResolvedReplacementMap, [&InParameters](const TTuple<FString, FString>& InTuple)
+		{
+			return TTuple<FString, FString>
+			{
+				UAruFunctionLibrary::ResolveParameterizedString(InParameters, InTuple.Key),
+				UAruFunctionLibrary::ResolveParameterizedString(InParameters, InTuple.Value)
+			};
+		});
+
+	TArray<FString> SortedKeys;
+	ResolvedReplacementMap.GetKeys(SortedKeys);
+	SortedKeys.Sort(
+		[](const FString& A, const FString& B)
+		{
+			return A.Len() > B.Len();
+		});
+
+	TArray<FString> PathSegments;
+	InPath.ParseIntoArray(PathSegments, TEXT("/"), true);
+	for (FString& Segment : PathSegments)
+	{
+		FString ModifiedSegment = Segment;
+		for (const FString& Key : SortedKeys)
+		{
+			if (!ModifiedSegment.Contains(Key))
+			{
+				continue;
+			}
+
+			if (const FString* Replacement = ResolvedReplacementMap.Find(Key))
+			{
+				ModifiedSegment = ModifiedSegment.Replace(*Key, **Replacement, ESearchCase::CaseSensitive);
+			}
+		}
+		Segment = ModifiedSegment;
+	}
+
+	return FString::Printf(TEXT("/%s"), *FString::Join(PathSegments, TEXT("/")));
+}
+
+bool FAruPredicate_AssetPathRedirector::IsSameOrDerivedClass(const FAssetData& InAsset, const FAssetData& InBaseAsset)
+{
+	// Classes of unloaded blueprints can't be found, their paths have to match exactly then.
+	const UClass* Class = InAsset.GetClass();
+	const UClass* BaseClass = InBaseAsset.GetClass();
+	if (Class != nullptr && BaseClass != nullptr)
+	{
+		return Class->IsChildOf(BaseClass);
+	}
+	return InAsset.AssetClassPath == InBaseAsset.AssetClassPath;
+}
+
+bool FAruPredicate_AssetPathRedirector::IsSameOrDerivedClass(
+	const IAssetRegistry& InAssetRegistry,
+	const FSoftObjectPath& InClassPath,
+	const FSoftObjectPath& InBaseClassPath)
+{
+	const UClass* BaseClass = Cast<UClass>(InBaseClassPath.ResolveObject());
+	FSoftObjectPath ClassPath = InClassPath;
+	while (!ClassPath.IsNull())
+	{
+		if (ClassPath == InBaseClassPath)
+		{
+			return true;
+		}
+
+		if (const UClass* Class = Cast<UClass>(ClassPath.ResolveObject()))
+		{
+			// Super classes of a loaded class are loaded too, an unloaded base class can't be one of them.
+			return BaseClass != nullptr && Class->IsChildOf(BaseClass);
+		}
+
+		// Unloaded blueprint classes are walked up through the parent class recorded in their asset tags.
+		const FAssetData Blueprint = FindBlueprintAsset(InAssetRegistry, ClassPath);
+		FString ParentClassPath;
+		if (!Blueprint.IsValid() || !Blueprint.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassPath))
+		{
+			return false;
+		}
+		ClassPath = FSoftObjectPath{FPackageName::ExportTextPathToObjectPath(ParentClassPath)};
+	}
+	return false;
+}
+
+bool FAruPredicate_AssetPathRedirector::IsClassReference(const FProperty* InProperty)
+{
+	const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+	return InProperty->IsA<FSoftClassProperty>()
+		|| (StructProperty != nullptr && StructProperty->Struct->IsChildOf(TBaseStructure<FSoftClassPath>::Get()));
+}
+
+bool FAruPredicate_AssetPathRedirector::DoesClassExist(const IAssetRegistry& InAssetRegistry, const FSoftObjectPath& InClassPath)
+{
+	// Native classes are always loaded.
+	return Cast<UClass>(InClassPath.ResolveObject()) != nullptr || FindBlueprintAsset(InAssetRegistry, InClassPath).IsValid();
+}
+
+FAssetData FAruPredicate_AssetPathRedirector::FindBlueprintAsset(const IAssetRegistry& InAssetRegistry, const FSoftObjectPath& InClassPath)
+{
+	TArray<FAssetData> Assets;
+	InAssetRegistry.GetAssetsByPackageName(InClassPath.GetLongPackageFName(), Assets);
+
+	const FString ClassPath = InClassPath.ToString();
+	for (const FAssetData& Asset : Assets)
+	{
+		FString GeneratedClassPath;
+		if (Asset.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath)
+			&& FPackageName::ExportTextPathToObjectPath(GeneratedClassPath) == ClassPath)
+		{
+			return Asset;
+		}
+	}
+	return {};
+}
+
 #undef LOCTEXT_NAMESPACE
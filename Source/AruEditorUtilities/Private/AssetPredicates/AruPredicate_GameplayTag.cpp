@@ -1,8 +1,18 @@
 ﻿#include "AssetPredicates/AruPredicate_GameplayTag.h"
+#include "AruPropertyPath.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_GameplayTag)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_GameplayTag"
 
+namespace Aru::GameplayTag
+{
+	const UScriptStruct* GetStructType(const FProperty* InProperty)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(InProperty);
+		return StructProperty != nullptr ? StructProperty->Struct : nullptr;
+	}
+}
+
 bool FAruPredicate_SetGameplayTag::Execute(
 	const FProperty* InProperty,
 	void* InValue,
@@ -44,7 +54,7 @@ bool FAruPredicate_SetGameplayTag::Execute(
 					"[{0}][{1}]Property:'{2}' is not a struct property."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -59,7 +69,7 @@ bool FAruPredicate_SetGameplayTag::Execute(
 					"[{0}][{1}]Property:'{2}' is not a gameplay tag property."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -80,7 +90,7 @@ bool FAruPredicate_SetGameplayTag::Execute(
 					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
 			));
 		return false;
@@ -92,8 +102,12 @@ bool FAruPredicate_SetGameplayTag::Execute(
 		return false;
 	}
 
-	StructProperty->CopyCompleteValue(InValue, PendingValue);
-	
+	// The tag already in place is neither written nor reported.
+	if (!WriteIfChanged(StructProperty, InValue, PendingValue))
+	{
+		return false;
+	}
+
 	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
 		FText::Format(
 			LOCTEXT(
@@ -147,7 +161,7 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 					"[{0}][{1}]Property:'{2}' is not a struct property."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -162,7 +176,7 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 					"[{0}][{1}]Property:'{2}' is not a gameplay tag container property."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -183,7 +197,7 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
 			));
 		return false;
@@ -194,8 +208,11 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 	{
 		return false;
 	}
-	
-	StructProperty->CopyCompleteValue(InValue, PendingValue);
+
+	if (!WriteIfChanged(StructProperty, InValue, PendingValue))
+	{
+		return false;
+	}
 
 	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
 		FText::Format(
@@ -208,4 +225,357 @@ bool FAruPredicate_SetGameplayTagContainer::Execute(
 	
 	return true;
 }
+
+bool FAruPredicate_AddGameplayTags::Execute(
+	const FProperty* InProperty,
+	void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return false;
+	}
+
+	if (Aru::GameplayTag::GetStructType(InProperty) != FGameplayTagContainer::StaticStruct())
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"AddGameplayTags_PropertyTypeMismatch",
+					"[{0}][{1}]Property:'{2}' is not a gameplay tag container property."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
+			));
+		return false;
+	}
+
+	FGameplayTagContainer* GameplayTagsPtr = static_cast<FGameplayTagContainer*>(InValue);
+	int32 AddedCount = 0;
+	for (const FGameplayTag& Tag : TagsToAdd)
+	{
+		if (!Tag.IsValid() || GameplayTagsPtr->HasTagExact(Tag))
+		{
+			continue;
+		}
+
+		// AddTag keeps the parent tag cache in sync.
+		GameplayTagsPtr->AddTag(Tag);
+		++AddedCount;
+	}
+
+	// Like the setters, containers already in the wanted state are neither reported nor executed.
+	if (AddedCount == 0)
+	{
+		return false;
+	}
+
+	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+		FText::Format(
+			LOCTEXT(
+				"AddGameplayTags_Result",
+				"[{0}][{1}]Property:'{2}': added {3} tag(s)."),
+			FText::FromString(GetCompactName()),
+			FText::FromString(Aru::ProcessResult::Success),
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+			AddedCount
+		));
+
+	return true;
+}
+
+bool FAruPredicate_RemoveGameplayTags::ShouldRemove(const FGameplayTag& InTag) const
+{
+	return bRemoveChildTags ? InTag.MatchesAny(TagsToRemove) : TagsToRemove.HasTagExact(InTag);
+}
+
+bool FAruPredicate_RemoveGameplayTags::Execute(
+	const FProperty* InProperty,
+	void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr || InValue == nullptr)
+	{
+		return false;
+	}
+
+	int32 RemovedCount = 0;
+	const UScriptStruct* StructType = Aru::GameplayTag::GetStructType(InProperty);
+	if (StructType == FGameplayTag::StaticStruct())
+	{
+		FGameplayTag* GameplayTagPtr = static_cast<FGameplayTag*>(InValue);
+		if (GameplayTagPtr->IsValid() && ShouldRemove(*GameplayTagPtr))
+		{
+			*GameplayTagPtr = FGameplayTag::EmptyTag;
+			++RemovedCount;
+		}
+	}
+	else if (StructType == FGameplayTagContainer::StaticStruct())
+	{
+		FGameplayTagContainer* GameplayTagsPtr = static_cast<FGameplayTagContainer*>(InValue);
+
+		TArray<FGameplayTag, TInlineAllocator<8>> PendingRemove;
+		for (const FGameplayTag& Tag : *GameplayTagsPtr)
+		{
+			if (ShouldRemove(Tag))
+			{
+				PendingRemove.Add(Tag);
+			}
+		}
+
+		for (const FGameplayTag& Tag : PendingRemove)
+		{
+			GameplayTagsPtr->RemoveTag(Tag, true);
+		}
+
+		// Parent tags are rebuilt once for the whole batch instead of once per removed tag.
+		if (PendingRemove.Num() > 0)
+		{
+			GameplayTagsPtr->FillParentTags();
+		}
+		RemovedCount = PendingRemove.Num();
+	}
+	else
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"RemoveGameplayTags_PropertyTypeMismatch",
+					"[{0}][{1}]Property:'{2}' is not a gameplay tag or gameplay tag container property."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
+			));
+		return false;
+	}
+
+	if (RemovedCount == 0)
+	{
+		return false;
+	}
+
+	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+		FText::Format(
+			LOCTEXT(
+				"RemoveGameplayTags_Result",
+				"[{0}][{1}]Property:'{2}': removed {3} tag(s)."),
+			FText::FromString(GetCompactName()),
+			FText::FromString(Aru::ProcessResult::Success),
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+			RemovedCount
+		));
+
+	return true;
+}
+
+void FAruPredicate_RenameGameplayTags::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	CachedRedirects.Reset();
+}
+
+FGameplayTag FAruPredicate_RenameGameplayTags::FindRedirect(const FGameplayTag& InTag) const
+{
+	if (const FGameplayTag* CachedRedirect = CachedRedirects.Find(InTag))
+	{
+		return *CachedRedirect;
+	}
+
+	FGameplayTag Result;
+	if (const FGameplayTag* Redirect = Redirects.Find(InTag))
+	{
+		Result = *Redirect;
+	}
+	else if (bRenameChildTags)
+	{
+		for (FGameplayTag ParentTag = InTag.RequestDirectParent(); ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+		{
+			const FGameplayTag* ParentRedirect = Redirects.Find(ParentTag);
+			if (ParentRedirect == nullptr)
+			{
+				continue;
+			}
+
+			const FString ChildSuffix = InTag.ToString().RightChop(ParentTag.ToString().Len());
+			const FString NewTagName = ParentRedirect->ToString() + ChildSuffix;
+			Result = FGameplayTag::RequestGameplayTag(FName{NewTagName}, false);
+			if (!Result.IsValid())
+			{
+				FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+					FText::Format(
+						LOCTEXT(
+							"RenameGameplayTags_ChildTagNotFound",
+							"[{0}][{1}]Tag:'{2}' can't be renamed, tag:'{3}' doesn't exist."),
+						FText::FromString(GetCompactName()),
+						FText::FromString(Aru::ProcessResult::Failed),
+						FText::FromString(InTag.ToString()),
+						FText::FromString(NewTagName)
+					));
+			}
+			break;
+		}
+	}
+
+	CachedRedirects.Add(InTag, Result);
+	return Result;
+}
+
+bool FAruPredicate_RenameGameplayTags::RenameTag(FGameplayTag& InOutTag) const
+{
+	const FGameplayTag NewTag = FindRedirect(InOutTag);
+	if (!NewTag.IsValid() || NewTag == InOutTag)
+	{
+		return false;
+	}
+
+	InOutTag = NewTag;
+	return true;
+}
+
+bool FAruPredicate_RenameGameplayTags::RenameTags(FGameplayTagContainer& InOutTags) const
+{
+	TArray<TPair<FGameplayTag, FGameplayTag>, TInlineAllocator<8>> PendingRename;
+	for (const FGameplayTag& Tag : InOutTags)
+	{
+		const FGameplayTag NewTag = FindRedirect(Tag);
+		if (NewTag.IsValid() && NewTag != Tag)
+		{
+			PendingRename.Emplace(Tag, NewTag);
+		}
+	}
+
+	if (PendingRename.Num() == 0)
+	{
+		return false;
+	}
+
+	for (const TPair<FGameplayTag, FGameplayTag>& Rename : PendingRename)
+	{
+		InOutTags.RemoveTag(Rename.Key, true);
+	}
+
+	for (const TPair<FGameplayTag, FGameplayTag>& Rename : PendingRename)
+	{
+		InOutTags.AddTag(Rename.Value);
+	}
+
+	// Drop the parents of the removed tags, AddTag already registered the parents of the new ones.
+	InOutTags.FillParentTags();
+	return true;
+}
+
+bool FAruPredicate_RenameGameplayTags::RenameTags(FGameplayTagQuery& InOutQuery) const
+{
+	TArray<FGameplayTag> TagDictionary = InOutQuery.GetGameplayTagArray();
+
+	bool bRenamed = false;
+	for (FGameplayTag& Tag : TagDictionary)
+	{
+		bRenamed |= RenameTag(Tag);
+	}
+
+	if (!bRenamed)
+	{
+		return false;
+	}
+
+	// The query expression references tags by dictionary index, so swapping the dictionary in place keeps the logic intact
+	// as long as no two tags were renamed to the same one.
+	if (TSet<FGameplayTag>{TagDictionary}.Num() == TagDictionary.Num())
+	{
+		InOutQuery.ReplaceTagsFast(FGameplayTagContainer::CreateFromArray(TagDictionary));
+		return true;
+	}
+
+	// Merged tags shrink the dictionary and would shift the indices, the query is rebuilt from its expression instead.
+	FGameplayTagQueryExpression Expression;
+	InOutQuery.GetQueryExpr(Expression);
+	RenameTags(Expression);
+
+	FGameplayTagQuery RenamedQuery;
+	RenamedQuery.Build(Expression, InOutQuery.GetDescription());
+	if (RenamedQuery.IsEmpty())
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"RenameGameplayTags_QueryRebuildFailed",
+					"[{0}][{1}]Query:'{2}' couldn't be rebuilt with the renamed tags, it was left unchanged."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(InOutQuery.GetDescription())
+			));
+		return false;
+	}
+
+	InOutQuery = MoveTemp(RenamedQuery);
+	return true;
+}
+
+void FAruPredicate_RenameGameplayTags::RenameTags(FGameplayTagQueryExpression& InOutExpression) const
+{
+	for (FGameplayTag& Tag : InOutExpression.TagSet)
+	{
+		RenameTag(Tag);
+	}
+
+	for (FGameplayTagQueryExpression& NestedExpression : InOutExpression.ExprSet)
+	{
+		RenameTags(NestedExpression);
+	}
+}
+
+bool FAruPredicate_RenameGameplayTags::Execute(
+	const FProperty* InProperty,
+	void* InValue,
+	const FInstancedPropertyBag& InParameters) const
+{
+	if (InProperty == nullptr || InValue == nullptr || Redirects.Num() == 0)
+	{
+		return false;
+	}
+
+	bool bRenamed = false;
+	const UScriptStruct* StructType = Aru::GameplayTag::GetStructType(InProperty);
+	if (StructType == FGameplayTag::StaticStruct())
+	{
+		bRenamed = RenameTag(*static_cast<FGameplayTag*>(InValue));
+	}
+	else if (StructType == FGameplayTagContainer::StaticStruct())
+	{
+		bRenamed = RenameTags(*static_cast<FGameplayTagContainer*>(InValue));
+	}
+	else if (StructType == FGameplayTagQuery::StaticStruct())
+	{
+		bRenamed = RenameTags(*static_cast<FGameplayTagQuery*>(InValue));
+	}
+	else
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"RenameGameplayTags_PropertyTypeMismatch",
+					"[{0}][{1}]Property:'{2}' is not a gameplay tag, gameplay tag container or gameplay tag query property."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
+			));
+		return false;
+	}
+
+	if (bRenamed)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+			FText::Format(
+				LOCTEXT(
+					"RenameGameplayTags_Result",
+					"[{0}][{1}]Property:'{2}': tags renamed."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Success),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
+			));
+	}
+
+	return bRenamed;
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
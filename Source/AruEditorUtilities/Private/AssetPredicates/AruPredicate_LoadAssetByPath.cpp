@@ -1,6 +1,7 @@
 ﻿#include "AssetPredicates/AruPredicate_LoadAssetByPath.h"
 
 #include "AruFunctionLibrary.h"
+#include "AruPropertyPath.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_LoadAssetByPath)
 
@@ -22,7 +23,7 @@ bool FAruPredicate_LoadAssetByPath::Execute(const FProperty* InProperty, void* I
 					"[{0}][{1}]Property:'{1}'. Asset path is empty."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -37,7 +38,7 @@ bool FAruPredicate_LoadAssetByPath::Execute(const FProperty* InProperty, void* I
 					"[{0}][{1}]Property:'{1}' is not an uobject."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -62,7 +63,7 @@ bool FAruPredicate_LoadAssetByPath::Execute(const FProperty* InProperty, void* I
 						"[{0}][{1}]Property:'{2}' class:{3}, new object class:{4}."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 					FText::FromString(ObjectProperty->PropertyClass ? ObjectProperty->PropertyClass->GetName() : FString{"NULL"}),
 					FText::FromString(LoadedAsset->GetClass() ? LoadedAsset->GetClass()->GetName() : FString{"NULL"})
 				));
@@ -70,6 +71,12 @@ bool FAruPredicate_LoadAssetByPath::Execute(const FProperty* InProperty, void* I
 			return false;
 		}
 
+		// Already referencing the asset, nothing changes.
+		if (ObjectProperty->GetObjectPropertyValue(InValue) == LoadedAsset)
+		{
+			return false;
+		}
+
 		ObjectProperty->SetObjectPropertyValue(InValue, LoadedAsset);
 		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
 			FText::Format(
@@ -92,7 +99,7 @@ bool FAruPredicate_LoadAssetByPath::Execute(const FProperty* InProperty, void* I
 				"[{0}][{1}]Property:'{2}'. Object not found by path:'{3}'."),
 			FText::FromString(GetCompactName()),
 			FText::FromString(Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 			FText::FromString(ResolvedPath)
 		));
 
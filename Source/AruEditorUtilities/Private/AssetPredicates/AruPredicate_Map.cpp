@@ -1,4 +1,5 @@
 ﻿#include "AssetPredicates/AruPredicate_Map.h"
+#include "AruPropertyPath.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Map)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_Map"
@@ -18,7 +19,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Property:'{2}' is not a map."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -32,7 +33,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. At least one predicate is required to complete the process."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -48,7 +49,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. Can't get map inner property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -63,7 +64,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. Malloc memory for key failed."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -95,7 +96,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. Predicate(s) for key executed failed."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -110,7 +111,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]The key pending to add already existed in this map:'{2}'."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -127,7 +128,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Failed to add new pair to map:'{2}'"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 
 		return false;
@@ -150,7 +151,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Failed to get new key from map:'{2}'"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 
 		return false;
@@ -169,7 +170,7 @@ bool FAruPredicate_AddMapPair::Execute(
 					"[{0}][{1}]Failed to get new value from map:'{2}'"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 
 		return false;
@@ -190,7 +191,7 @@ bool FAruPredicate_AddMapPair::Execute(
 				"[{0}][{1}]Added element to map:'{2}'."),
 			FText::FromString(GetCompactName()),
 			FText::FromString(Aru::ProcessResult::Success),
-			FText::FromString(InProperty->GetName())
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 		));
 
 	return bExecutedSuccessfully;
@@ -211,7 +212,7 @@ bool FAruPredicate_RemoveMapPair::Execute(
 					"[{0}][{1}]Property:'{2}' is not a map."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -225,7 +226,7 @@ bool FAruPredicate_RemoveMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. At least one filter is required to complete the process."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -241,7 +242,7 @@ bool FAruPredicate_RemoveMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. Can't get map inner property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -311,7 +312,7 @@ bool FAruPredicate_RemoveMapPair::Execute(
 			FText::FromString(GetCompactName()),
 			FText::FromString(PendingRemove.Num() > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
 			PendingRemove.Num(),
-			FText::FromString(InProperty->GetName()))
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)))
 	);
 
 	return PendingRemove.Num() > 0;
@@ -332,7 +333,7 @@ bool FAruPredicate_ModifyMapPair::Execute(
 					"[{0}][{1}]Property:'{2}' is not a map."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -346,7 +347,7 @@ bool FAruPredicate_ModifyMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. At least one filter is required to complete the process."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -362,7 +363,7 @@ bool FAruPredicate_ModifyMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. Can't get map inner property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -433,7 +434,7 @@ bool FAruPredicate_ModifyMapPair::Execute(
 					"[{0}][{1}]Map:'{2}'. Malloc memory for key failed."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 			
 			return false;
@@ -467,7 +468,7 @@ bool FAruPredicate_ModifyMapPair::Execute(
 							"[{0}][{1}]The key pending to set already existed in this map:'{2}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 					));
 				continue;
 			}
@@ -498,11 +499,32 @@ bool FAruPredicate_ModifyMapPair::Execute(
 				"[{0}][{1}]Map:'{2}': {3} element(s) matched, {4} modified'."),
 			FText::FromString(GetCompactName()),
 			FText::FromString(ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 			PendingToModify.Num(),
 			ModifiedCount
 		));
 
 	return ModifiedCount > 0;
 }
+
+void FAruPredicate_AddMapPair::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(PredicatesForKey, InParameters);
+	Aru::BeginProcessing(PredicatesForValue, InParameters);
+}
+
+void FAruPredicate_RemoveMapPair::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(KeyFilters, InParameters);
+	Aru::BeginProcessing(ValueFilters, InParameters);
+}
+
+void FAruPredicate_ModifyMapPair::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(KeyFilters, InParameters);
+	Aru::BeginProcessing(ValueFilters, InParameters);
+	Aru::BeginProcessing(PredicatesForKey, InParameters);
+	Aru::BeginProcessing(PredicatesForValue, InParameters);
+}
+
 #undef LOCTEXT_NAMESPACE
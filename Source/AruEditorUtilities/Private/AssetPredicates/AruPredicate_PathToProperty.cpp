@@ -58,4 +58,10 @@ bool FAruPredicate_PathToProperty::Execute(
 
 	return bExecutedSuccessfully;
 }
+
+void FAruPredicate_PathToProperty::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Predicate, InParameters);
+}
+
 #undef LOCTEXT_NAMESPACE
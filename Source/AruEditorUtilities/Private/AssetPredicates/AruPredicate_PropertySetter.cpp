@@ -1,10 +1,127 @@
 ﻿#include "AssetPredicates/AruPredicate_PropertySetter.h"
+#include "AruActionProgram.h"
+#include "AruPropertyPath.h"
 #include "AruFunctionLibrary.h"
+#include "AruNumericKernels.h"
 #include "UObject/PropertyAccessUtil.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_PropertySetter)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_PropertySetter"
 
+void FAruPredicate_PropertySetter::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	ParameterSlots.Reset();
+	SourceBindings.Reset();
+}
+
+FAruPredicate_PropertySetter::FParameterSlot& FAruPredicate_PropertySetter::FindOrAddParameterSlot(
+	const FInstancedPropertyBag& InParameters,
+	const UField* InValueType,
+	bool& bOutAdded) const
+{
+	bOutAdded = false;
+	for (FParameterSlot& Slot : ParameterSlots)
+	{
+		if (Slot.Parameters == &InParameters && Slot.ValueType == InValueType)
+		{
+			return Slot;
+		}
+	}
+
+	bOutAdded = true;
+	FParameterSlot& NewSlot = ParameterSlots.AddDefaulted_GetRef();
+	NewSlot.Parameters = &InParameters;
+	NewSlot.ValueType = InValueType;
+	NewSlot.ResolvedName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
+	return NewSlot;
+}
+
+const FAruPredicate_PropertySetter::FSourceBinding& FAruPredicate_PropertySetter::BindSource(
+	const FFieldClass* SourceProperty,
+	const FInstancedPropertyBag& InParameters,
+	const UStruct* SourceType,
+	const FFieldClass* TargetProperty) const
+{
+	const FInstancedPropertyBag* Parameters = ValueSource == EAruValueSource::Value ? nullptr : &InParameters;
+	for (const FSourceBinding& Binding : SourceBindings)
+	{
+		if (Binding.Parameters == Parameters
+			&& Binding.SourceProperty == SourceProperty
+			&& Binding.TargetProperty == TargetProperty
+			&& Binding.SourceType == SourceType)
+		{
+			return Binding;
+		}
+	}
+
+	FSourceBinding& NewBinding = SourceBindings.AddDefaulted_GetRef();
+	NewBinding.Parameters = Parameters;
+	NewBinding.SourceProperty = SourceProperty;
+	NewBinding.TargetProperty = TargetProperty;
+	NewBinding.SourceType = SourceType;
+	switch (ValueSource)
+	{
+	case EAruValueSource::Value: NewBinding.Value = GetValueFromStructProperty(SourceProperty, NewBinding.Property, SourceType); break;
+	case EAruValueSource::Object: NewBinding.Value = GetValueFromObjectAsset(SourceProperty, InParameters, NewBinding.Property, SourceType); break;
+	case EAruValueSource::DataTable: NewBinding.Value = GetValueFromDataTable(SourceProperty, InParameters, NewBinding.Property, SourceType); break;
+	case EAruValueSource::Parameters: break;
+	}
+
+	// Values are copied as is, e.g. a float source can't be written into a double or a soft object into an object property.
+	if (NewBinding.Value.IsSet() && TargetProperty != nullptr && NewBinding.Property->GetClass() != TargetProperty)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+			FText::Format(
+				LOCTEXT(
+					"PropertySetter_PropertyTypeMismatch",
+					"[{0}][{1}]Mismatch between target:'{2}' and source:'{3}' property types."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Failed),
+				FText::FromString(TargetProperty->GetName()),
+				FText::FromString(NewBinding.Property->GetClass()->GetName())
+			));
+		NewBinding.Value.Reset();
+	}
+	return NewBinding;
+}
+
+bool FAruPredicate_PropertySetter::GetNewNumericValue(
+	const FNumericProperty* InProperty,
+	const FInstancedPropertyBag& InParameters,
+	uint64& OutValue) const
+{
+	if (ValueSource == EAruValueSource::Parameters)
+	{
+		return false;
+	}
+
+	const FSourceBinding& Binding = BindSource(FNumericProperty::StaticClass(), InParameters, nullptr);
+	const FNumericProperty* SourceProperty = CastField<FNumericProperty>(Binding.Property);
+	if (!Binding.Value.IsSet() || Binding.Value.GetValue() == nullptr || SourceProperty == nullptr)
+	{
+		return false;
+	}
+
+	const void* SourceValue = Binding.Value.GetValue();
+	if (InProperty->IsFloatingPoint())
+	{
+		InProperty->SetFloatingPointPropertyValue(
+			&OutValue,
+			SourceProperty->IsFloatingPoint()
+				? SourceProperty->GetFloatingPointPropertyValue(SourceValue)
+				: static_cast<double>(SourceProperty->GetSignedIntPropertyValue(SourceValue)));
+	}
+	else
+	{
+		InProperty->SetIntPropertyValue(
+			&OutValue,
+			SourceProperty->IsFloatingPoint()
+				? static_cast<int64>(SourceProperty->GetFloatingPointPropertyValue(SourceValue))
+				: SourceProperty->GetSignedIntPropertyValue(SourceValue));
+	}
+	return true;
+}
+
 bool FAruPredicate_PropertySetter::IsCompatibleType(
 	const FProperty* TargetProperty,
 	const void* TargetValue,
@@ -83,6 +200,7 @@ bool FAruPredicate_PropertySetter::IsCompatibleStructType(
 
 TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromStructProperty(
 	const FFieldClass* SourceProperty,
+	const FProperty*& OutProperty,
 	const UStruct* SourceType) const
 {
 	static FName ValueName{"NewValue"};
@@ -123,12 +241,14 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromStructProperty(
 		return {};
 	}
 
+	OutProperty = TargetProperty;
 	return TOptional<const void*>{PropertyValue};
 }
 
 TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromObjectAsset(
 	const FFieldClass* SourceProperty,
 	const FInstancedPropertyBag& InParameters,
+	const FProperty*& OutProperty,
 	const UStruct* SourceType) const
 {
 	if (PathToProperty.IsEmpty())
@@ -221,12 +341,14 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromObjectAsset(
 		return {};
 	}
 
+	OutProperty = PropertyContext.PropertyPtr;
 	return TOptional<const void*>{PropertyContext.ValuePtr.GetValue()};
 }
 
 TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromDataTable(
 	const FFieldClass* SourceProperty,
 	const FInstancedPropertyBag& InParameters,
+	const FProperty*& OutProperty,
 	const UStruct* SourceType) const
 {
 	if (PathToProperty.IsEmpty())
@@ -344,6 +466,7 @@ TOptional<const void*> FAruPredicate_PropertySetter::GetValueFromDataTable(
 		return {};
 	}
 
+	OutProperty = PropertyContext.PropertyPtr;
 	return TOptional<const void*>{PropertyContext.ValuePtr.GetValue()};
 }
 
@@ -388,18 +511,19 @@ bool FAruPredicate_SetBoolValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a bool property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
 
 	bool Result = false;
+	bool bChanged = false;
 	const bool PreviousValue = BoolProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<bool, EPropertyBagResult> ParameterValue = InParameters.GetValueBool(FName{ResolvedParameterName});
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<bool>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueBool(InName); });
+		const bool* ParameterValue = Slot.Value.TryGet<bool>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -408,17 +532,30 @@ bool FAruPredicate_SetBoolValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
-		BoolProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
+		bChanged = PreviousValue != *ParameterValue;
+		if (bChanged)
+		{
+			BoolProperty->SetPropertyValue(InValue, *ParameterValue);
+		}
 		Result = true;
 	}
 	else
 	{
-		Result = SetPropertyValue<FBoolProperty>(InProperty, InValue, InParameters);
+		Result = SetPropertyValue<FBoolProperty>(InProperty, InValue, InParameters, bChanged);
+
+		// Read back through the target's own bit mask, the source value isn't a bitfield.
+		bChanged = BoolProperty->GetPropertyValue(InValue) != PreviousValue;
+	}
+
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
 	}
 
 	if (Result == true)
@@ -430,7 +567,7 @@ bool FAruPredicate_SetBoolValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				PreviousValue ? LOCTEXT("True", "True") : LOCTEXT("False", "False"),
 				BoolProperty->GetPropertyValue(InValue) ? LOCTEXT("True", "True") : LOCTEXT("False", "False")
 			));
@@ -444,13 +581,22 @@ bool FAruPredicate_SetBoolValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 
 	return Result;
 }
 
+void FAruPredicate_SetBoolValue::LowerGuards(FAruProgramBuilder& InBuilder) const
+{
+	// Execute writes and reports nothing for a value already in place.
+	if (ValueSource == EAruValueSource::Value)
+	{
+		InBuilder.SkipIfBoolEqual(NewValue);
+	}
+}
+
 bool FAruPredicate_SetFloatValue::Execute(
 	const FProperty* InProperty,
 	void* InValue,
@@ -492,7 +638,7 @@ bool FAruPredicate_SetFloatValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a bool property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -506,18 +652,19 @@ bool FAruPredicate_SetFloatValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a float property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
 
 	bool Result = false;
+	bool bChanged = false;
 	const float PreviousValue = NumericProperty->GetFloatingPointPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<double, EPropertyBagResult> ParameterValue = InParameters.GetValueDouble(FName{ResolvedParameterName});
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<double>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueDouble(InName); });
+		const double* ParameterValue = Slot.Value.TryGet<double>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -526,19 +673,31 @@ bool FAruPredicate_SetFloatValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
-		NumericProperty->SetFloatingPointPropertyValue(InValue, ParameterValue.GetValue());
+		// Converted to the property's own type first, so the comparison sees what would actually be stored.
+		uint64 PendingValue = 0;
+		NumericProperty->SetFloatingPointPropertyValue(&PendingValue, *ParameterValue);
+		bChanged = WriteIfChanged(NumericProperty, InValue, &PendingValue);
 		Result = true;
 	}
 	else
 	{
-		Result = SetPropertyValue<FNumericProperty>(InProperty, InValue, InParameters);
+		// Converted like parameter values, the source may be stored with another width than the property.
+		uint64 PendingValue = 0;
+		Result = GetNewNumericValue(NumericProperty, InParameters, PendingValue);
+		bChanged = Result && WriteIfChanged(NumericProperty, InValue, &PendingValue);
 	}
 	
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
+	}
+
 	if (Result == true)
 	{
 		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
@@ -548,7 +707,7 @@ bool FAruPredicate_SetFloatValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				PreviousValue,
 				NumericProperty->GetFloatingPointPropertyValue(InValue)
 			));
@@ -562,13 +721,81 @@ bool FAruPredicate_SetFloatValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 
 	return Result;
 }
 
+void FAruPredicate_SetFloatValue::LowerGuards(FAruProgramBuilder& InBuilder) const
+{
+	if (ValueSource == EAruValueSource::Value)
+	{
+		InBuilder.SkipIfFloatEqual(NewValue);
+	}
+}
+
+int32 FAruPredicate_SetFloatValue::ExecuteBatch(
+	const FProperty* InElementProperty,
+	void* InValues,
+	const int32 InNum,
+	const TBitArray<>& InMatches,
+	const FInstancedPropertyBag& InParameters) const
+{
+	// Only sources resolving to one value for the whole span can be written in bulk,
+	// everything else, including type mismatches, goes through Execute to keep its reporting.
+	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InElementProperty);
+	if ((ValueSource != EAruValueSource::Value && ValueSource != EAruValueSource::Parameters)
+		|| NumericProperty == nullptr
+		|| !NumericProperty->IsFloatingPoint()
+		|| InValues == nullptr
+		|| InNum > InMatches.Num())
+	{
+		return FAruPredicate_PropertySetter::ExecuteBatch(InElementProperty, InValues, InNum, InMatches, InParameters);
+	}
+
+	double PendingValue = NewValue;
+	if (ValueSource == EAruValueSource::Parameters)
+	{
+		const FParameterSlot& Slot = BindParameter<double>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueDouble(InName); });
+		const double* ParameterValue = Slot.Value.TryGet<double>();
+		if (ParameterValue == nullptr)
+		{
+			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+				FText::Format(
+					LOCTEXT(
+						"NoPropertyFoundInParameter",
+						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+					FText::FromString(GetCompactName()),
+					FText::FromString(Aru::ProcessResult::Failed),
+					FText::FromString(InElementProperty->GetName()),
+					FText::FromString(Slot.ResolvedName)
+				));
+			return 0;
+		}
+		PendingValue = *ParameterValue;
+	}
+
+	const int32 NumChanged = Aru::Numeric::SetValues(NumericProperty->GetClass(), InValues, InNum, InMatches, PendingValue);
+	if (NumChanged > 0)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+			FText::Format(
+				LOCTEXT(
+					"SetFloatProperty_BatchSuccess",
+					"[{0}][{1}]Property:'{2}' {3} value(s) set to {4}."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Success),
+				FText::FromString(InElementProperty->GetName()),
+				NumChanged,
+				PendingValue
+			));
+	}
+
+	return FMath::Max(NumChanged, 0);
+}
+
 bool FAruPredicate_SetIntegerValue::Execute(
 	const FProperty* InProperty,
 	void* InValue,
@@ -610,7 +837,7 @@ bool FAruPredicate_SetIntegerValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a integer property."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -624,18 +851,19 @@ bool FAruPredicate_SetIntegerValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a integer property."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
 
 	bool Result = false;
+	bool bChanged = false;
 	const float PreviousValue = NumericProperty->GetSignedIntPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<int64, EPropertyBagResult> ParameterValue = InParameters.GetValueInt64(FName{ResolvedParameterName});
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<int64>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueInt64(InName); });
+		const int64* ParameterValue = Slot.Value.TryGet<int64>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -644,17 +872,28 @@ bool FAruPredicate_SetIntegerValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
-		NumericProperty->SetIntPropertyValue(InValue, ParameterValue.GetValue());
+		uint64 PendingValue = 0;
+		NumericProperty->SetIntPropertyValue(&PendingValue, *ParameterValue);
+		bChanged = WriteIfChanged(NumericProperty, InValue, &PendingValue);
 		Result = true;
 	}
 	else
 	{
-		Result = SetPropertyValue<FNumericProperty>(InProperty, InValue, InParameters);
+		// Converted like parameter values, the source may be stored with another width than the property.
+		uint64 PendingValue = 0;
+		Result = GetNewNumericValue(NumericProperty, InParameters, PendingValue);
+		bChanged = Result && WriteIfChanged(NumericProperty, InValue, &PendingValue);
+	}
+
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
 	}
 
 	if (Result == true)
@@ -666,7 +905,7 @@ bool FAruPredicate_SetIntegerValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				PreviousValue,
 				NumericProperty->GetSignedIntPropertyValue(InValue)
 			));
@@ -680,13 +919,81 @@ bool FAruPredicate_SetIntegerValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 
 	return Result;
 }
 
+void FAruPredicate_SetIntegerValue::LowerGuards(FAruProgramBuilder& InBuilder) const
+{
+	if (ValueSource == EAruValueSource::Value)
+	{
+		InBuilder.SkipIfInt64Equal(NewValue);
+	}
+}
+
+int32 FAruPredicate_SetIntegerValue::ExecuteBatch(
+	const FProperty* InElementProperty,
+	void* InValues,
+	const int32 InNum,
+	const TBitArray<>& InMatches,
+	const FInstancedPropertyBag& InParameters) const
+{
+	// Only sources resolving to one value for the whole span can be written in bulk,
+	// everything else, including type mismatches, goes through Execute to keep its reporting.
+	const FNumericProperty* NumericProperty = CastField<FNumericProperty>(InElementProperty);
+	if ((ValueSource != EAruValueSource::Value && ValueSource != EAruValueSource::Parameters)
+		|| NumericProperty == nullptr
+		|| !NumericProperty->IsInteger()
+		|| InValues == nullptr
+		|| InNum > InMatches.Num())
+	{
+		return FAruPredicate_PropertySetter::ExecuteBatch(InElementProperty, InValues, InNum, InMatches, InParameters);
+	}
+
+	int64 PendingValue = NewValue;
+	if (ValueSource == EAruValueSource::Parameters)
+	{
+		const FParameterSlot& Slot = BindParameter<int64>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueInt64(InName); });
+		const int64* ParameterValue = Slot.Value.TryGet<int64>();
+		if (ParameterValue == nullptr)
+		{
+			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
+				FText::Format(
+					LOCTEXT(
+						"NoPropertyFoundInParameter",
+						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
+					FText::FromString(GetCompactName()),
+					FText::FromString(Aru::ProcessResult::Failed),
+					FText::FromString(InElementProperty->GetName()),
+					FText::FromString(Slot.ResolvedName)
+				));
+			return 0;
+		}
+		PendingValue = *ParameterValue;
+	}
+
+	const int32 NumChanged = Aru::Numeric::SetValues(NumericProperty->GetClass(), InValues, InNum, InMatches, PendingValue);
+	if (NumChanged > 0)
+	{
+		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
+			FText::Format(
+				LOCTEXT(
+					"SetIntegerProperty_BatchSuccess",
+					"[{0}][{1}]Property:'{2}' {3} value(s) set to {4}."),
+				FText::FromString(GetCompactName()),
+				FText::FromString(Aru::ProcessResult::Success),
+				FText::FromString(InElementProperty->GetName()),
+				NumChanged,
+				PendingValue
+			));
+	}
+
+	return FMath::Max(NumChanged, 0);
+}
+
 bool FAruPredicate_SetStringValue::Execute(
 	const FProperty* InProperty,
 	void* InValue,
@@ -728,18 +1035,19 @@ bool FAruPredicate_SetStringValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a string property."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
 
 	bool Result = false;
+	bool bChanged = false;
 	const FString PreviousValue = StrProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<FString, EPropertyBagResult> ParameterValue = InParameters.GetValueString(FName{ResolvedParameterName});
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<FString>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueString(InName); });
+		const FString* ParameterValue = Slot.Value.TryGet<FString>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -748,17 +1056,23 @@ bool FAruPredicate_SetStringValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
-		StrProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
+		bChanged = WriteIfChanged(StrProperty, InValue, ParameterValue);
 		Result = true;
 	}
 	else
 	{
-		Result = SetPropertyValue<FStrProperty>(InProperty, InValue, InParameters);
+		Result = SetPropertyValue<FStrProperty>(InProperty, InValue, InParameters, bChanged);
+	}
+
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
 	}
 
 	if (Result == true)
@@ -770,7 +1084,7 @@ bool FAruPredicate_SetStringValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(PreviousValue),
 				FText::FromString(StrProperty->GetPropertyValue(InValue))
 			));
@@ -784,7 +1098,7 @@ bool FAruPredicate_SetStringValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 	return Result;
@@ -831,18 +1145,19 @@ bool FAruPredicate_SetTextValue::Execute(
 					"[{0}][{1}]Property:'{0}' is not a text property."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
 
 	bool Result = false;
+	bool bChanged = false;
 	const FText PreviousValue = TextProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<FText, EPropertyBagResult> ParameterValue = InParameters.GetValueText(FName{ResolvedParameterName});
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<FText>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueText(InName); });
+		const FText* ParameterValue = Slot.Value.TryGet<FText>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -851,12 +1166,12 @@ bool FAruPredicate_SetTextValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
-		TextProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
+		bChanged = WriteIfChanged(TextProperty, InValue, ParameterValue);
 		Result = true;
 	}
 	else
@@ -871,7 +1186,7 @@ bool FAruPredicate_SetTextValue::Execute(
 					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
 			));
 			return false;
@@ -890,10 +1205,16 @@ bool FAruPredicate_SetTextValue::Execute(
 		}
 
 		FText PendingTextValue = FText::FromString(*StringValue);
-		TextProperty->CopyCompleteValue(InValue, &PendingTextValue);
+		bChanged = WriteIfChanged(TextProperty, InValue, &PendingTextValue);
 		Result = true;
 	}
 
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
+	}
+
 	if (Result == true)
 	{
 		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
@@ -903,7 +1224,7 @@ bool FAruPredicate_SetTextValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				PreviousValue,
 				TextProperty->GetPropertyValue(InValue)
 			));
@@ -917,7 +1238,7 @@ bool FAruPredicate_SetTextValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 	
@@ -965,18 +1286,19 @@ bool FAruPredicate_SetNameValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not an FName property."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
 	
 	bool Result = false;
+	bool bChanged = false;
 	const FName PreviousValue = NameProperty->GetPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<FName, EPropertyBagResult> ParameterValue = InParameters.GetValueName(FName{ResolvedParameterName});
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<FName>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueName(InName); });
+		const FName* ParameterValue = Slot.Value.TryGet<FName>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -985,19 +1307,25 @@ bool FAruPredicate_SetNameValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
-		NameProperty->SetPropertyValue(InValue, ParameterValue.GetValue());
+		bChanged = WriteIfChanged(NameProperty, InValue, ParameterValue);
 		Result = true;
 	}
 	else
 	{
-		Result = SetPropertyValue<FNameProperty>(InProperty, InValue, InParameters);
+		Result = SetPropertyValue<FNameProperty>(InProperty, InValue, InParameters, bChanged);
 	}
 	
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
+	}
+
 	if (Result == true)
 	{
 		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
@@ -1007,7 +1335,7 @@ bool FAruPredicate_SetNameValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromName(PreviousValue),
 				FText::FromName(NameProperty->GetPropertyValue(InValue))
 			));
@@ -1021,13 +1349,38 @@ bool FAruPredicate_SetNameValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 
 	return Result;
 }
 
+void FAruPredicate_SetEnumValue::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	FAruPredicate_PropertySetter::BeginProcessing(InParameters);
+	ResolvedValues.Reset();
+}
+
+int64 FAruPredicate_SetEnumValue::ResolveEnumValue(const UEnum* InEnum, const FString& InName) const
+{
+	for (const TTuple<const UEnum*, FString, int64>& Resolved : ResolvedValues)
+	{
+		if (Resolved.Get<0>() == InEnum && Resolved.Get<1>().Equals(InName, ESearchCase::CaseSensitive))
+		{
+			return Resolved.Get<2>();
+		}
+	}
+
+	// Sources giving a different name per property aren't worth remembering past a few names.
+	const int64 Value = InEnum->GetValueByNameString(InName);
+	if (ResolvedValues.Num() < 8)
+	{
+		ResolvedValues.Emplace(InEnum, InName, Value);
+	}
+	return Value;
+}
+
 bool FAruPredicate_SetEnumValue::Execute(
 	const FProperty* InProperty,
 	void* InValue,
@@ -1069,7 +1422,7 @@ bool FAruPredicate_SetEnumValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a enum property."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -1084,7 +1437,7 @@ bool FAruPredicate_SetEnumValue::Execute(
 					"[{0}][{1}]Property:'{2}' enum type is NULL."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName())
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -1096,12 +1449,16 @@ bool FAruPredicate_SetEnumValue::Execute(
 	}
 
 	bool Result = false;
+	bool bChanged = false;
 	const int64 PreviousValue = UnderlyingProperty->GetSignedIntPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<uint8, EPropertyBagResult> ParameterValue = InParameters.GetValueEnum(FName{ResolvedParameterName}, EnumType);
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<uint8>(
+			InParameters,
+			[&InParameters, EnumType](const FName InName) { return InParameters.GetValueEnum(InName, EnumType); },
+			EnumType);
+		const uint8* ParameterValue = Slot.Value.TryGet<uint8>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -1110,12 +1467,17 @@ bool FAruPredicate_SetEnumValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
-		UnderlyingProperty->SetIntPropertyValue(InValue, static_cast<int64>(ParameterValue.GetValue()));
+		const int64 PendingEnumValue = static_cast<int64>(*ParameterValue);
+		bChanged = PendingEnumValue != PreviousValue;
+		if (bChanged)
+		{
+			UnderlyingProperty->SetIntPropertyValue(InValue, PendingEnumValue);
+		}
 		Result = true;
 	}
 	else
@@ -1130,7 +1492,7 @@ bool FAruPredicate_SetEnumValue::Execute(
 					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
 			));
 			return false;
@@ -1148,7 +1510,7 @@ bool FAruPredicate_SetEnumValue::Execute(
 			return false;
 		}
 
-		const int64 PendingEnumValue = EnumType->GetValueByNameString(*StringValue);
+		const int64 PendingEnumValue = ResolveEnumValue(EnumType, *StringValue);
 		if (PendingEnumValue == INDEX_NONE)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
@@ -1158,16 +1520,26 @@ bool FAruPredicate_SetEnumValue::Execute(
 					"[{0}][{1}]Property:'{2}', can't find valid enum value by '{3}'."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(*StringValue)
 			));
 			return false;
 		}
 
-		UnderlyingProperty->SetIntPropertyValue(InValue, PendingEnumValue);
+		bChanged = PendingEnumValue != PreviousValue;
+		if (bChanged)
+		{
+			UnderlyingProperty->SetIntPropertyValue(InValue, PendingEnumValue);
+		}
 		Result = true;
 	}
 	
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
+	}
+
 	if (Result == true)
 	{
 		FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
@@ -1177,7 +1549,7 @@ bool FAruPredicate_SetEnumValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				PreviousValue,
 				UnderlyingProperty->GetSignedIntPropertyValue(InValue)
 			));
@@ -1191,7 +1563,7 @@ bool FAruPredicate_SetEnumValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 
@@ -1239,7 +1611,7 @@ bool FAruPredicate_SetObjectValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not an uobject property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -1254,18 +1626,19 @@ bool FAruPredicate_SetObjectValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a valid uobject property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
 
 	bool Result = false;
+	bool bChanged = false;
 	const UObject* PreviousValue = ObjectProperty->GetObjectPropertyValue(InValue);
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<UObject*, EPropertyBagResult> ParameterValue = InParameters.GetValueObject(FName{ResolvedParameterName});
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<UObject*>(InParameters, [&InParameters](const FName InName) { return InParameters.GetValueObject(InName); });
+		const UObject** ParameterValue = Slot.Value.TryGet<UObject*>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -1274,16 +1647,20 @@ bool FAruPredicate_SetObjectValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
 		
-		const UObject* ObjectPtr = ParameterValue.GetValue();
+		const UObject* ObjectPtr = *ParameterValue;
 		if (ObjectPtr == nullptr)
 		{
-			ObjectProperty->SetObjectPropertyValue(InValue, nullptr);
+			bChanged = PreviousValue != nullptr;
+			if (bChanged)
+			{
+				ObjectProperty->SetObjectPropertyValue(InValue, nullptr);
+			}
 		}
 		else
 		{
@@ -1300,22 +1677,32 @@ bool FAruPredicate_SetObjectValue::Execute(
 				LOCTEXT(
 					"SetObjectProperty_ObjectClassMismatch",
 					"Property:'{0}' is not a valid uobject property."),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 				return false;
 			}
 
-			ObjectProperty->SetObjectPropertyValue(InValue, ParameterValue.GetValue());
+			bChanged = PreviousValue != ObjectPtr;
+			if (bChanged)
+			{
+				ObjectProperty->SetObjectPropertyValue(InValue, *ParameterValue);
+			}
 		}
 		
 		Result = true;
 	}
-	else if (auto* PendingValue = GetNewValueBySourceType<FObjectPropertyBase>(InParameters, ClassType).GetPtrOrNull())
+	else if (auto* PendingValue = GetNewValueBySourceType<FObjectPropertyBase>(InParameters, ClassType, ObjectProperty).GetPtrOrNull())
 	{
-		ObjectProperty->CopyCompleteValue(InValue, *PendingValue);
+		bChanged = WriteIfChanged(ObjectProperty, InValue, *PendingValue);
 		Result = true;
 	}
 
+	// An identical value was already there, nothing was written.
+	if (Result && !bChanged)
+	{
+		return false;
+	}
+
 	if (Result == true)
 	{
 		const UObject* InNewValue = ObjectProperty->GetObjectPropertyValue(InValue);
@@ -1326,7 +1713,7 @@ bool FAruPredicate_SetObjectValue::Execute(
 					"[{0}][{1}]Property:'{2}' previous value:{3}, new value:{4}"),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Success),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(!!PreviousValue? PreviousValue->GetName() : FString{"nullptr"}),
 				FText::FromString(!!InNewValue? InNewValue->GetName() : FString{"nullptr"})
 			));
@@ -1340,7 +1727,7 @@ bool FAruPredicate_SetObjectValue::Execute(
 					"[{0}][{1}]Property:'{2}' operation failure."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 	}
 
@@ -1388,7 +1775,7 @@ bool FAruPredicate_SetStructValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a struct property."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -1403,7 +1790,7 @@ bool FAruPredicate_SetStructValue::Execute(
 							"[{0}][{1}]Property:'{2}' struct type is NULL."),
 								FText::FromString(GetCompactName()),
 								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 					));
 		return false;
 	}
@@ -1418,16 +1805,19 @@ bool FAruPredicate_SetStructValue::Execute(
 							"[{0}][{1}]Property:'{2}' struct type is instanced struct, use 'Set Instanced Struct' instead."),
 								FText::FromString(GetCompactName()),
 								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 					));
 		return false;
 	}
 
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<FStructView, EPropertyBagResult> ParameterValue = InParameters.GetValueStruct(FName{ResolvedParameterName}, SourceStructType);
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<FStructView>(
+			InParameters,
+			[&InParameters, SourceStructType](const FName InName) { return InParameters.GetValueStruct(InName, SourceStructType); },
+			SourceStructType);
+		const FStructView* ParameterValue = Slot.Value.TryGet<FStructView>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -1436,13 +1826,13 @@ bool FAruPredicate_SetStructValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
 
-		FStructView& StructValue = ParameterValue.GetValue();
+		const FStructView& StructValue = *ParameterValue;
 		if (!StructValue.GetScriptStruct()->IsChildOf(SourceStructType))
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
@@ -1452,13 +1842,18 @@ bool FAruPredicate_SetStructValue::Execute(
 					"[{0}][{1}]Property:'{2}'.Source type:{3}, target type:{4}."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(SourceStructType->GetName()),
 				FText::FromString(StructValue.GetScriptStruct()->GetName())
 			));
 			return false;
 		}
 
+		if (StructProperty->Struct->CompareScriptStruct(InValue, StructValue.GetMemory(), PPF_None))
+		{
+			return false;
+		}
+
 		StructProperty->Struct->CopyScriptStruct(InValue, StructValue.GetMemory());
 		return true;
 	}
@@ -1473,7 +1868,7 @@ bool FAruPredicate_SetStructValue::Execute(
 					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
 			));
 		return false;
@@ -1513,7 +1908,10 @@ bool FAruPredicate_SetStructValue::Execute(
 		return false;
 	}
 
-	StructProperty->CopyCompleteValue(InValue, PendingStructValue);
+	if (!WriteIfChanged(StructProperty, InValue, PendingStructValue))
+	{
+		return false;
+	}
 
 	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
 			FText::Format(
@@ -1568,7 +1966,7 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a struct property."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -1583,7 +1981,7 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 							"[{0}][{1}]Property:'{2}' struct type is NULL or not an instanced struct."),
 								FText::FromString(GetCompactName()),
 								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 					));
 		return false;
 	}
@@ -1598,17 +1996,19 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 							"[{0}][{1}]Property:'{2}' is an invalid instanced struct."),
 								FText::FromString(GetCompactName()),
 								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 					));
 		return false;
 	}
 
 	if (ValueSource == EAruValueSource::Parameters)
 	{
-		const FString&& ResolvedParameterName = UAruFunctionLibrary::ResolveParameterizedString(InParameters, ParameterName);
-		TValueOrError<FStructView, EPropertyBagResult> ParameterValue = InParameters.GetValueStruct(
-			FName{ResolvedParameterName}, FInstancedStruct::StaticStruct());
-		if (!ParameterValue.HasValue())
+		const FParameterSlot& Slot = BindParameter<FStructView>(
+			InParameters,
+			[&InParameters](const FName InName) { return InParameters.GetValueStruct(InName, FInstancedStruct::StaticStruct()); },
+			FInstancedStruct::StaticStruct());
+		const FStructView* ParameterValue = Slot.Value.TryGet<FStructView>();
+		if (ParameterValue == nullptr)
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
 				FText::Format(
@@ -1617,13 +2017,13 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 						"[{0}][{1}]Property:'{2}'. Can't find '{3}' in parameters."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Failed),
-					FText::FromString(InProperty->GetName()),
-					FText::FromString(ResolvedParameterName)
+					FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
+					FText::FromString(Slot.ResolvedName)
 				));
 			return false;
 		}
 
-		FStructView& StructValue = ParameterValue.GetValue();
+		const FStructView& StructValue = *ParameterValue;
 		if (StructValue.GetScriptStruct() != FInstancedStruct::StaticStruct())
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
@@ -1633,11 +2033,16 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 							"[{0}][{1}]Property:'{2}' struct type is not an instanced struct."),
 								FText::FromString(GetCompactName()),
 								FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 					));
 			return false;
 		}
 
+		if (StructProperty->Struct->CompareScriptStruct(InValue, StructValue.GetMemory(), PPF_None))
+		{
+			return false;
+		}
+
 		StructProperty->Struct->CopyScriptStruct(InValue, StructValue.GetMemory());
 		return true;
 	}
@@ -1652,7 +2057,7 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 					"[{0}][{1}]Property:'{2}': can't find new value by source type:'{3}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName()),
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 				FText::FromString(StaticEnum<EAruValueSource>()->GetValueAsString(ValueSource))
 			));
 		
@@ -1665,7 +2070,10 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 		return false;
 	}
 
-	StructProperty->CopyCompleteValue(InValue, PendingValue);
+	if (!WriteIfChanged(StructProperty, InValue, PendingValue))
+	{
+		return false;
+	}
 	
 	FMessageLog{FName{"AruEditorUtilitiesModule"}}.Info(
 		FText::Format(
@@ -1674,7 +2082,7 @@ bool FAruPredicate_SetInstancedStructValue::Execute(
 				"[{0}][{1}]Property:'{2}': operation succeeded."),
 					FText::FromString(GetCompactName()),
 					FText::FromString(Aru::ProcessResult::Success),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 		));
 	
 	return true;
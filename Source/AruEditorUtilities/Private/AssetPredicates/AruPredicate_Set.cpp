@@ -1,4 +1,5 @@
 ﻿#include "AssetPredicates/AruPredicate_Set.h"
+#include "AruPropertyPath.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AruPredicate_Set)
 
 #define LOCTEXT_NAMESPACE "AruPredicate_Set"
@@ -18,7 +19,7 @@ bool FAruPredicate_AddSetElement::Execute(
 					"[{0}][{1}]Property:'{2}' is not a set."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -32,7 +33,7 @@ bool FAruPredicate_AddSetElement::Execute(
 					"[{0}][{1}]Set:'{2}'. At least one predicate is required to complete the process."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -47,7 +48,7 @@ bool FAruPredicate_AddSetElement::Execute(
 					"[{0}][{1}]Set:'{2}'. Can't get element property."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		
 		return false;
@@ -63,7 +64,7 @@ bool FAruPredicate_AddSetElement::Execute(
 					"[{0}][{1}]Set:'{2}'. Malloc memory for element failed."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		
 		return false;
@@ -95,7 +96,7 @@ bool FAruPredicate_AddSetElement::Execute(
 					"[{0}][{1}]Set:'{2}'. Predicate(s) for element executed failed."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -110,7 +111,7 @@ bool FAruPredicate_AddSetElement::Execute(
 					"[{0}][{1}]The element pending to add already existed in this set:'{2}'."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -147,7 +148,7 @@ bool FAruPredicate_RemoveSetValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a set."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		return false;
 	}
@@ -202,7 +203,7 @@ bool FAruPredicate_RemoveSetValue::Execute(
 			FText::FromString(GetCompactName()),
 			FText::FromString(PendingRemove.Num() > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
 			PendingRemove.Num(),
-			FText::FromString(InProperty->GetName()))
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)))
 	);
 
 	return PendingRemove.Num() > 0;
@@ -223,7 +224,7 @@ bool FAruPredicate_ModifySetValue::Execute(
 					"[{0}][{1}]Property:'{2}' is not a set."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		
 		return false;
@@ -244,7 +245,7 @@ bool FAruPredicate_ModifySetValue::Execute(
 					"[{0}][{1}]Set:'{2}'. At least one filter is required to complete the process."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Failed),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 		
 		return false;
@@ -293,7 +294,7 @@ bool FAruPredicate_ModifySetValue::Execute(
 					"[{0}][{1}]Set:'{2}'. Malloc memory for element failed."),
 				FText::FromString(GetCompactName()),
 				FText::FromString(Aru::ProcessResult::Error),
-				FText::FromString(InProperty->GetName())
+				FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 			));
 			
 			return false;
@@ -333,7 +334,7 @@ bool FAruPredicate_ModifySetValue::Execute(
 							"[{0}][{1}]The element pending to set already existed in this map:'{2}'."),
 						FText::FromString(GetCompactName()),
 						FText::FromString(Aru::ProcessResult::Failed),
-						FText::FromString(InProperty->GetName())
+						FText::FromString(Aru::GetPropertyDisplayPath(InProperty))
 					));
 			
 			continue;
@@ -352,7 +353,7 @@ bool FAruPredicate_ModifySetValue::Execute(
 				"[{0}][{1}]Array:'{2}': {3} element(s) matched, {4} modified'."),
 			FText::FromString(GetCompactName()),
 			FText::FromString(ModifiedCount > 0 ? Aru::ProcessResult::Success : Aru::ProcessResult::Failed),
-			FText::FromString(InProperty->GetName()),
+			FText::FromString(Aru::GetPropertyDisplayPath(InProperty)),
 			MatchedCount,
 			ModifiedCount
 		));
@@ -360,4 +361,20 @@ bool FAruPredicate_ModifySetValue::Execute(
 	return ModifiedCount > 0;
 }
 
+void FAruPredicate_AddSetElement::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Predicates, InParameters);
+}
+
+void FAruPredicate_RemoveSetValue::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Filters, InParameters);
+}
+
+void FAruPredicate_ModifySetValue::BeginProcessing(const FInstancedPropertyBag& InParameters) const
+{
+	Aru::BeginProcessing(Filters, InParameters);
+	Aru::BeginProcessing(Predicates, InParameters);
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,106 @@
+﻿#pragma once
+
+#include "AruNumericKernels.h"
+
+struct FAruActionDefinition;
+class FAruActionProgram;
+
+enum class EAruOpCode : uint8
+{
+	// Conditions, the first one evaluating to false ends the program as unmet.
+	CompareNumeric,
+	CompareRange,
+	CompareBool,
+	CompareObject,
+	// Calls IsConditionMet on a filter that has no native form.
+	TestFilter,
+
+	// Predicates, a jump skips the instructions up to Target when the value already holds the constant to write.
+	JumpIfBoolEqual,
+	JumpIfFloatEqual,
+	JumpIfInt64Equal,
+	// Calls Execute on a predicate.
+	ExecutePredicate
+};
+
+struct FAruInstruction
+{
+	EAruOpCode Op = EAruOpCode::TestFilter;
+	bool bInvert = false;
+
+	// Whether the condition this came from references the run parameters, see EAruConditionScope.
+	bool bParameterized = false;
+	Aru::Numeric::ECompare Compare = Aru::Numeric::ECompare::Equal;
+
+	// Binding, filter or predicate the instruction refers to, depending on Op.
+	int32 Index = INDEX_NONE;
+	int32 Target = INDEX_NONE;
+
+	double Number = 0.0;
+	double MaxNumber = 0.0;
+	int64 Integer = 0;
+	const UObject* Object = nullptr;
+};
+
+/**
+ * Lowers the conditions and predicates of one action into instructions, see FAruFilter::Lower and FAruPredicate::LowerGuards.
+ * Filters and predicates that lower nothing are called through their virtual functions instead.
+ */
+class ARUEDITORUTILITIES_API FAruProgramBuilder
+{
+public:
+	explicit FAruProgramBuilder(FAruActionProgram& InProgram) : Program(InProgram) {}
+
+	void CompareNumeric(const Aru::Numeric::ECompare InCompare, const double InCondition, const bool bInvert);
+	void CompareRange(const double InMin, const double InMax, const bool bInvert);
+	void CompareBool(const bool bExpected, const bool bInvert);
+	void CompareObject(const UObject* InObject, const bool bInvert);
+
+	/** Guards skipping the predicate being lowered, only for values of exactly that property type. */
+	void SkipIfBoolEqual(const bool InValue);
+	void SkipIfFloatEqual(const float InValue);
+	void SkipIfInt64Equal(const int64 InValue);
+
+private:
+	friend class FAruActionProgram;
+
+	FAruInstruction& AddCondition(const EAruOpCode InOp, const bool bInvert);
+	FAruInstruction& AddGuard(const EAruOpCode InOp);
+
+	FAruActionProgram& Program;
+	bool bParameterized = false;
+};
+
+/**
+ * The conditions and predicates of an action as two flat instruction streams, so common filters and setters run
+ * without virtual calls through their instanced structs. Programs point into the action they were compiled from,
+ * which must outlive them and not change.
+ */
+class ARUEDITORUTILITIES_API FAruActionProgram
+{
+public:
+	static FAruActionProgram Compile(const FAruActionDefinition& InAction);
+
+	/** Same as the action's own AreConditionsMet and ExecutePredicates. */
+	bool AreConditionsMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, const EAruConditionScope InScope = EAruConditionScope::All) const;
+	bool ExecutePredicates(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const;
+
+private:
+	friend class FAruProgramBuilder;
+
+	bool CompareNumeric(const FAruInstruction& InInstruction, const FProperty* InProperty, const void* InValue) const;
+	bool CompareRange(const FAruInstruction& InInstruction, const FProperty* InProperty, const void* InValue) const;
+	bool CompareObject(const FAruInstruction& InInstruction, const FProperty* InProperty, const void* InValue) const;
+
+	TArray<FAruInstruction> Conditions;
+	TArray<FAruInstruction> Predicates;
+	TArray<const FAruFilter*> Filters;
+	TArray<const FAruPredicate*> PredicateStructs;
+
+	// Paths of the compared objects, for soft references.
+	TArray<FSoftObjectPath> ObjectPaths;
+
+	// Bound to the property class last seen by each instruction, like the numeric filters do.
+	mutable TArray<Aru::Numeric::FCompareBinding> CompareBindings;
+	mutable TArray<Aru::Numeric::FRangeBinding> RangeBindings;
+};
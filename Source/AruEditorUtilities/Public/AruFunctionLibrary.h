@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "AruTypes.h"
+#include "AruActionProgram.h"
+#include "AruPropertyQuery.h"
+#include "UObject/ObjectKey.h"
 #include "AruFunctionLibrary.generated.h"
 
 struct FAruActionDefinition;
@@ -17,23 +20,228 @@ struct FAruPropertyContext
 	FORCEINLINE bool IsValid() const { return PropertyPtr != nullptr && ValuePtr.IsSet(); }
 };
 
+/** Actions taking part in a run, with the parameters they are invoked with and how deep they may reach. */
+struct FAruActionSource
+{
+	TConstArrayView<FAruActionDefinition> Actions;
+	const FInstancedPropertyBag* Parameters = nullptr;
+	int32 MaxSearchDepth = 0;
+
+	// Name the source's results are reported under when a run has several.
+	FString Label;
+};
+
+/** An action of a run bound to the parameters of its source. */
+struct FAruBoundAction
+{
+	const FAruActionDefinition* Action = nullptr;
+	const FInstancedPropertyBag* Parameters = nullptr;
+
+	// Frames with no more remaining time than this are beyond the search depth of the action's source.
+	int32 MinRemainTime = 0;
+
+	int32 SourceIndex = 0;
+
+	// Whether the action is bound to more than one source, e.g. once per parameter set of a matrix run.
+	bool bShared = false;
+
+	// The action compiled for the run, null if the run doesn't compile its actions.
+	const FAruActionProgram* Program = nullptr;
+
+	FORCEINLINE bool Reaches(const int32 InRemainTime) const { return InRemainTime > MinRemainTime; }
+
+	FORCEINLINE bool AreConditionsMet(const FProperty* InProperty, const void* InValue, const EAruConditionScope InScope = EAruConditionScope::All) const
+	{
+		return Program != nullptr
+			? Program->AreConditionsMet(InProperty, InValue, *Parameters, InScope)
+			: Action->AreConditionsMet(InProperty, InValue, *Parameters, InScope);
+	}
+
+	FORCEINLINE bool ExecutePredicates(const FProperty* InProperty, void* InValue) const
+	{
+		return Program != nullptr
+			? Program->ExecutePredicates(InProperty, InValue, *Parameters)
+			: Action->ExecutePredicates(InProperty, InValue, *Parameters);
+	}
+};
+
+/**
+ * Actions of a run grouped by the property types their conditions can be met by, each group is built the first time its type shows up.
+ * Groups keep the actions in source order, then in the order of each source's actions.
+ */
+struct FAruActionBuckets
+{
+	/** With bCompileActions, every distinct action of the sources is compiled once, see FAruActionProgram. */
+	FAruActionBuckets(TArray<FAruActionSource>&& InSources, const bool bCompileActions);
+
+	// The view stays valid while other buckets get added, the bucket arrays own their allocations.
+	TConstArrayView<FAruBoundAction> Find(const FProperty* InProperty);
+
+	FORCEINLINE TConstArrayView<FAruActionSource> GetSources() const { return Sources; }
+
+private:
+	using FBucketKey = TPair<const FFieldClass*, const UScriptStruct*>;
+
+	TArray<FAruActionSource> Sources;
+	TSet<const FAruActionDefinition*> SharedActions;
+
+	// Filled up front and never added to afterwards, bound actions point into it.
+	TMap<const FAruActionDefinition*, FAruActionProgram> Programs;
+	int32 MaxSearchDepth = 0;
+	TMap<FBucketKey, TArray<FAruBoundAction>> Buckets;
+};
+
+/** Condition outcomes of struct values evaluated during a run, so identical copies are only evaluated once. */
+struct FAruConditionMemo
+{
+	/** The outcome InAction's conditions had for a value of InProperty identical to InValue, unset if there is none yet. */
+	TOptional<bool> Find(const FAruBoundAction& InAction, const FStructProperty* InProperty, const void* InValue, const uint32 InValueHash) const;
+
+	void Add(const FAruBoundAction& InAction, const FStructProperty* InProperty, const void* InValue, const uint32 InValueHash, const bool bConditionsMet);
+
+	/** Hash of a property value by its contents, identical values hash alike regardless of where their memory is. */
+	static uint32 HashValue(const FProperty* InProperty, const void* InValue);
+
+private:
+	// The same action may be bound to different parameters in a fused run.
+	using FMemoKey = TTuple<const FAruActionDefinition*, const FInstancedPropertyBag*, const FStructProperty*, uint32>;
+
+	struct FMemoEntry
+	{
+		// A copy, the evaluated value itself may be changed or freed later in the run.
+		FInstancedStruct Value;
+		bool bConditionsMet = false;
+	};
+
+	TMap<FMemoKey, TArray<FMemoEntry, TInlineAllocator<1>>> Entries;
+};
+
+enum class EAruTraversalStep : uint8
+{
+	Object,
+	Struct,
+	Container
+};
+
+/** Steps of each kind taken from the processed asset to the current property. */
+struct FAruTraversalDepth
+{
+	int32 ObjectHops = 0;
+	int32 StructNesting = 0;
+	int32 ContainerNesting = 0;
+
+	FAruTraversalDepth Step(const EAruTraversalStep InStep) const;
+};
+
+/** State shared by every property processed during one run. */
+struct FAruProcessingState
+{
+	FAruProcessingState(const TArray<FAruActionDefinition>& InActions, const FAruProcessConfig& InConfig);
+
+	/**
+	 * A run over the actions of several sources, InConfig's parameters and search depth are only used for the property query.
+	 * The constructor above binds InActions once per set of InConfig's parameter matrix, or once to its parameters without one.
+	 */
+	FAruProcessingState(TArray<FAruActionSource>&& InSources, const FAruProcessConfig& InConfig);
+
+	/**
+	 * Records that the properties of InObject get processed with InRemainTime at InDepth, reached with InQueryStates.
+	 * Returns false if an earlier visit had at least as much of every budget left and could match at least the same query paths,
+	 * everything this visit could reach has been processed then, so shared and mutually referencing objects are only processed once.
+	 * Otherwise the visit is recorded next to the earlier ones it doesn't cover, records are never joined.
+	 * Visits are only compared with visits reaching the object through the same path, see bVisitsDependOnPath.
+	 */
+	bool MarkVisited(
+		const UObject* InObject,
+		const int32 InRemainTime,
+		const FAruTraversalDepth& InDepth = {},
+		const FAruPropertyQuery::FStateSet InQueryStates = 0,
+		const uint32 InPathHash = 0);
+
+	/** Whether the traversal may descend into InObject, referenced through InProperty, under the run's config. */
+	bool CanDescendInto(const FObjectPropertyBase* InProperty, const UObject* InObject) const;
+
+	/** Whether the traversal policy allows one more step of the given kind from InDepth. */
+	bool CanDescend(const FAruTraversalDepth& InDepth, const EAruTraversalStep InStep) const;
+
+	/** Calls Modify on InObject the first time predicates are about to write to it during the run. */
+	void PrepareForModification(UObject* InObject);
+
+	/** Records that predicates of the given action source actually changed InNumChanges values of InObject. */
+	void RecordChanges(UObject* InObject, const int32 InNumChanges, const int32 InSourceIndex = 0);
+
+	/**
+	 * Clears the dirty flag Modify set on packages in which nothing ended up changing, e.g. when every setter found its value in place.
+	 * Returns whether anything changed during the run.
+	 */
+	bool FinishModifications();
+
+	/** Packages of the objects changed so far. */
+	TArray<UPackage*> GetModifiedPackages() const;
+
+	FORCEINLINE int32 GetNumChanges() const { return NumChanges; }
+	FORCEINLINE int32 GetNumChanges(const int32 InSourceIndex) const { return NumChangesBySource.IsValidIndex(InSourceIndex) ? NumChangesBySource[InSourceIndex] : 0; }
+
+	FAruActionBuckets ActionBuckets;
+	FAruConditionMemo ConditionMemo;
+	const FAruProcessConfig& Config;
+
+	// Compiled from the config's property query, bValidPropertyQuery is false if it couldn't be parsed.
+	FAruPropertyQuery PropertyQuery;
+	bool bValidPropertyQuery = true;
+
+	// The object whose properties are iterated for the asset being processed, the CDO for blueprints.
+	const UObject* RootObject = nullptr;
+
+	// Set when some action's conditions depend on where a property sits, e.g. its location or path. An object reached
+	// through another path is visited again then, a visit through a path the conditions rejected says nothing about the others.
+	bool bVisitsDependOnPath = false;
+
+private:
+	struct FVisit
+	{
+		int32 RemainTime = 0;
+		FAruTraversalDepth Depth;
+		FAruPropertyQuery::FStateSet QueryStates = 0;
+
+		/** Whether this visit had at least as much of every budget left as InOther and could match at least the same query paths. */
+		bool Covers(const FVisit& InOther) const
+		{
+			return RemainTime >= InOther.RemainTime
+				&& Depth.ObjectHops <= InOther.Depth.ObjectHops
+				&& Depth.StructNesting <= InOther.Depth.StructNesting
+				&& Depth.ContainerNesting <= InOther.Depth.ContainerNesting
+				&& (QueryStates & InOther.QueryStates) == InOther.QueryStates;
+		}
+	};
+
+	// Visits of an object none of which covers another, most objects only ever have one.
+	TMap<TPair<FObjectKey, uint32>, TArray<FVisit, TInlineAllocator<1>>> VisitedObjects;
+	TSet<FObjectKey> ModifiedObjects;
+	TSet<FObjectKey> ChangedObjects;
+
+	// Whether each package touched by Modify was already dirty before the run first modified an object in it.
+	TMap<FObjectKey, bool> PackagesWereDirty;
+	int32 NumChanges = 0;
+	TArray<int32> NumChangesBySource;
+};
+
 struct FAruProcessingParameters
 {
 	const TArray<FAruActionDefinition>&		Actions;
 	const FInstancedPropertyBag&			Parameters;
 	const int32								RemainTime;
+	FAruProcessingState&					State;
+	const FAruTraversalDepth				Depth;
 
 	FAruProcessingParameters() = delete;
 	FAruProcessingParameters(
 		const TArray<FAruActionDefinition>& InActions,
 		const FInstancedPropertyBag&		InParameters,
-		const int32							InRemainTime)
-			: Actions(InActions), Parameters(InParameters), RemainTime(InRemainTime){};
-
-	FAruProcessingParameters GetSubsequentParameters() const
-	{
-		return {Actions, Parameters, RemainTime-1};
-	} 
+		const int32							InRemainTime,
+		FAruProcessingState&				InState,
+		const FAruTraversalDepth&			InDepth = {})
+			: Actions(InActions), Parameters(InParameters), RemainTime(InRemainTime), State(InState), Depth(InDepth){};
 };
 
 UCLASS()
@@ -51,6 +259,14 @@ public:
 	UFUNCTION(BlueprintCallable, CallInEditor)
 	static bool ProcessAsset(UObject* const Object, const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs);
 
+	/**
+	 * Runs the actions of every config in ConfigRuns over Objects with a single traversal per asset.
+	 * On every property the actions run in the order of ConfigRuns, then in the order of each config's definitions.
+	 * Configs supplies everything else about the run, its own parameters and search depth are ignored.
+	 */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	static bool ProcessAssetsWithConfigs(const TArray<UObject*>& Objects, const TArray<FAruActionConfigRun>& ConfigRuns, const FAruProcessConfig& Configs);
+
 	static FAruPropertyContext FindPropertyByPath(
 		const FProperty* InProperty,
 		const void* InPropertyValue,
@@ -66,10 +282,43 @@ public:
 		const void* InPropertyValue,
 		const TArrayView<FString> PropertyChain);
 
+	/** Processes a property and everything nested in it, see FAruPropertyTraversal for pausable runs. */
 	static bool ProcessContainerValues(
 		FProperty* PropertyPtr,
 		void* ValuePtr,
 		const FAruProcessingParameters& InParameters);
 
 	static FString ResolveParameterizedString(const FInstancedPropertyBag& InParameters, const FString& SourceString);
+
+	/** Whether SourceString references a parameter, i.e. ResolveParameterizedString may change it. */
+	static bool IsParameterizedString(const FString& SourceString);
+
+	/**
+	 * The path of the object a hard or soft object reference, or an FSoftObjectPath value, points to.
+	 * Soft references are read as paths and never loaded. Returns false for any other property, OutPath is null for empty references.
+	 */
+	static bool GetReferencedPath(const FProperty* InProperty, const void* InValue, FSoftObjectPath& OutPath);
+
+	/** Whether GetReferencedPath reads values of the given property type. InStructType is the struct of struct properties. */
+	static bool IsReferenceType(const FFieldClass* InFieldClass, const UScriptStruct* InStructType);
+
+	/** Whether InProperty holds a soft reference, i.e. a TSoftObjectPtr, TSoftClassPtr or FSoftObjectPath. */
+	static bool IsSoftReference(const FProperty* InProperty);
+
+	/**
+	 * Saves the dirty ones of InPackages in batches of InBatchSize with asynchronous file writes,
+	 * optionally checking them all out of source control in one operation first. Returns the number of packages saved.
+	 */
+	static int32 SavePackages(const TArray<UPackage*>& InPackages, const bool bCheckOut, const int32 InBatchSize);
+
+private:
+	static void BeginProcessing(const TArray<FAruActionDefinition>& Actions, const FAruProcessConfig& Configs);
+
+	/** Processes every object with State inside one transaction, then reports, cleans up and saves as Configs asks for. */
+	static bool ProcessAssetsInternal(const TArray<UObject*>& Objects, const FAruProcessConfig& Configs, FAruProcessingState& State);
+
+	static bool ProcessAssetInternal(
+		UObject* const Object,
+		const FAruProcessConfig& Configs,
+		FAruProcessingState& State);
 };
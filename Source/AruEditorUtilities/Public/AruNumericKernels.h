@@ -0,0 +1,67 @@
+﻿#pragma once
+
+#include "AruTypes.h"
+
+namespace Aru::Numeric
+{
+	enum class ECompare : uint8
+	{
+		Equal,
+		NotEqual,
+		Greater,
+		Less,
+		GreaterOrEqual
+	};
+
+	/** A condition value converted once into the domain of the property type it is compared against. */
+	struct FOperand
+	{
+		double Float = 0.0;
+		int64 Signed = 0;
+		uint64 Unsigned = 0;
+
+		// Set when the result doesn't depend on the value, e.g. testing an integer for equality with a fractional condition.
+		TOptional<bool> ConstantResult;
+	};
+
+	using FCompareKernel = bool(*)(const void* InValue, const FOperand& InOperand);
+	using FRangeKernel = bool(*)(const void* InValue, const FOperand& InMin, const FOperand& InMax);
+
+	/**
+	 * Batch kernels run over InNum contiguous values and only touch the bits still set in InOutMatches,
+	 * clearing every bit whose value doesn't evaluate to !bInvert.
+	 */
+	using FCompareBatchKernel = void(*)(const void* InValues, const int32 InNum, const FOperand& InOperand, const bool bInvert, TBitArray<>& InOutMatches);
+	using FRangeBatchKernel = void(*)(const void* InValues, const int32 InNum, const FOperand& InMin, const FOperand& InMax, const bool bInvert, TBitArray<>& InOutMatches);
+
+	/** Kernels specialized for one numeric property class, they stay null if the class isn't numeric. */
+	struct FCompareBinding
+	{
+		const FFieldClass* FieldClass = nullptr;
+		FCompareKernel Kernel = nullptr;
+		FCompareBatchKernel BatchKernel = nullptr;
+		FOperand Operand;
+	};
+
+	struct FRangeBinding
+	{
+		const FFieldClass* FieldClass = nullptr;
+		FRangeKernel Kernel = nullptr;
+		FRangeBatchKernel BatchKernel = nullptr;
+		FOperand Min;
+		FOperand Max;
+	};
+
+	ECompare ToCompare(const EAruNumericCompareOp InCompareOp);
+
+	void Bind(const FFieldClass* InFieldClass, const ECompare InCompare, const double InCondition, FCompareBinding& OutBinding);
+	void Bind(const FFieldClass* InFieldClass, const double InMin, const double InMax, FRangeBinding& OutBinding);
+
+	/**
+	 * Writes InNewValue, converted to the value type of InFieldClass, into every value whose bit is set in InMatches.
+	 * Returns the number of values that actually changed, or INDEX_NONE if InFieldClass can't hold that kind of value
+	 * (floating point for the double overload, integer for the int64 one).
+	 */
+	int32 SetValues(const FFieldClass* InFieldClass, void* InValues, const int32 InNum, const TBitArray<>& InMatches, const double InNewValue);
+	int32 SetValues(const FFieldClass* InFieldClass, void* InValues, const int32 InNum, const TBitArray<>& InMatches, const int64 InNewValue);
+}
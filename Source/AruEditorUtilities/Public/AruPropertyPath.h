@@ -0,0 +1,54 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * One step of a property path, either a member named after its property or an item of an array, set or map.
+ * Map items are followed by a "Key" or "Value" member step, e.g. "Stats[2].Value".
+ */
+struct FAruPropertyPathSegment
+{
+	FName Name;
+	int32 Index = INDEX_NONE;
+
+	// The property the step lands on. Item steps of a map land on the pair and hold its key.
+	const FProperty* Property = nullptr;
+	const void* Value = nullptr;
+
+	FORCEINLINE bool IsItem() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * Path from the processed asset to a property, gathered from the traversal stack.
+ * Segments compare by FName and index, the string form is only built when asked for, e.g. for logging.
+ */
+class ARUEDITORUTILITIES_API FAruPropertyPath
+{
+public:
+	FORCEINLINE void AddMember(const FProperty* InProperty, const void* InValue = nullptr) { Segments.Add({InProperty->GetFName(), INDEX_NONE, InProperty, InValue}); }
+	FORCEINLINE void AddMember(const FName InName, const FProperty* InProperty, const void* InValue = nullptr) { Segments.Add({InName, INDEX_NONE, InProperty, InValue}); }
+	FORCEINLINE void AddItem(const int32 InIndex, const FProperty* InProperty, const void* InValue = nullptr) { Segments.Add({NAME_None, InIndex, InProperty, InValue}); }
+
+	FORCEINLINE int32 Num() const { return Segments.Num(); }
+	FORCEINLINE bool IsEmpty() const { return Segments.IsEmpty(); }
+	FORCEINLINE const FAruPropertyPathSegment& operator[](const int32 InIndex) const { return Segments[InIndex]; }
+	FORCEINLINE TConstArrayView<FAruPropertyPathSegment> GetSegments() const { return Segments; }
+
+	/** The property the path ends on. */
+	FORCEINLINE const FProperty* GetLeafProperty() const { return Segments.IsEmpty() ? nullptr : Segments.Last().Property; }
+
+	/** E.g. "Abilities[0].Effects[2].Magnitude". */
+	FString ToString() const;
+
+	/** Path of the property the running traversal invokes actions on, unset outside of a traversal. */
+	static TOptional<FAruPropertyPath> GetCurrent();
+
+private:
+	TArray<FAruPropertyPathSegment, TInlineAllocator<16>> Segments;
+};
+
+namespace Aru
+{
+	/** Name to report InProperty with, its full path when it is the property the running traversal is visiting. */
+	ARUEDITORUTILITIES_API FString GetPropertyDisplayPath(const FProperty* InProperty);
+}
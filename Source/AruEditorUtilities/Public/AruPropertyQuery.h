@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class FAruPropertyPath;
+
+/**
+ * Compiled property path query, e.g. "Effects[*].Magnitude", "Stats["Fire"].Value" or "**.Damage".
+ *
+ * Segments are separated by '.', a segment is one of:
+ * - Name, a member property. "*" matches any member.
+ * - [Index], an array, set or map item by position. "[*]" matches any item.
+ * - ["Key"], an item by its value or a map pair by its key, compared to the exported text of the value.
+ * - "**", any number of segments, including none.
+ *
+ * The query is matched step by step as the traversal descends, so everything that can't lead to a match is never visited.
+ * A state set tracks every position in the query the path so far can be at.
+ */
+class ARUEDITORUTILITIES_API FAruPropertyQuery
+{
+public:
+	using FStateSet = uint64;
+
+	/** Returns an unset optional if InQuery can't be parsed. An empty query compiles to one that leaves the traversal alone. */
+	static TOptional<FAruPropertyQuery> Compile(const FString& InQuery);
+
+	FORCEINLINE bool IsEmpty() const { return Steps.IsEmpty(); }
+
+	/** States before the first segment of a path, none for an empty query. */
+	FStateSet GetInitialStates() const;
+
+	FStateSet AdvanceMember(const FStateSet InStates, const FName InName) const;
+
+	/** InKeyProperty and InKeyValue identify the item for key selectors, the item itself or the key of a map pair. */
+	FStateSet AdvanceItem(const FStateSet InStates, const int32 InIndex, const FProperty* InKeyProperty = nullptr, const void* InKeyValue = nullptr) const;
+
+	/** Whether the path that led to InStates is matched by the whole query. */
+	FORCEINLINE bool IsMatch(const FStateSet InStates) const { return (InStates & FinalState()) != 0; }
+
+	/** Whether some path continuing from InStates could still be matched. */
+	FORCEINLINE bool CanContinue(const FStateSet InStates) const { return (InStates & (FinalState() - 1)) != 0; }
+
+	/** Whether the next item step depends on which item it is, i.e. items can't all be treated alike. */
+	bool IsItemSelective(const FStateSet InStates) const;
+
+	/** Matches a gathered path, with bIncludeNested the path may also continue below a match. */
+	bool Matches(const FAruPropertyPath& InPath, const bool bIncludeNested = false) const;
+
+private:
+	enum class EStepKind : uint8
+	{
+		Member,
+		AnyMember,
+		Item,
+		AnyItem,
+		ItemKey,
+		Recursive
+	};
+
+	struct FStep
+	{
+		EStepKind Kind = EStepKind::Member;
+		FName Name;
+		int32 Index = INDEX_NONE;
+		FString Key;
+	};
+
+	// One bit per step plus the final state.
+	static constexpr int32 MaxSteps = 63;
+
+	FORCEINLINE FStateSet FinalState() const { return FStateSet{1} << Steps.Num(); }
+
+	FStateSet Close(FStateSet InStates) const;
+	static bool MatchesKey(const FStep& InStep, const FProperty* InKeyProperty, const void* InKeyValue);
+
+	TArray<FStep> Steps;
+};
@@ -0,0 +1,112 @@
+﻿#pragma once
+
+#include "AruFunctionLibrary.h"
+#include "AruPropertyPath.h"
+
+/**
+ * Walks every property reachable from the queued ones with an explicit work stack instead of recursion.
+ * A property is visited, i.e. the run's actions are invoked on it, after everything nested in it has been.
+ *
+ * Run can stop after a time budget and be called again later to resume, e.g. to spread a large run over several ticks.
+ * The traversed data must stay alive and unchanged in between, frames point straight into it.
+ */
+class ARUEDITORUTILITIES_API FAruPropertyTraversal
+{
+public:
+	/** Actions are invoked with the parameters of the source they come from, see FAruActionBuckets. */
+	explicit FAruPropertyTraversal(FAruProcessingState& InState)
+		: State(InState) {}
+
+	/** Queues a single property, InValue points to its value. InOwner is the object holding it, if known. */
+	void AddProperty(FProperty* InProperty, void* InValue, const int32 InRemainTime, const FAruTraversalDepth& InDepth = {}, UObject* InOwner = nullptr);
+
+	/** Queues every property of InType, InContainer points to the object or struct holding them. */
+	void AddProperties(const UStruct* InType, void* InContainer, const int32 InRemainTime, const FAruTraversalDepth& InDepth = {});
+
+	/**
+	 * Processes queued properties until none is left or InMaxSeconds elapsed, a non positive budget means no limit.
+	 * Returns true once the traversal is finished.
+	 */
+	bool Run(const double InMaxSeconds = 0.0);
+
+	/**
+	 * Called on every visited property after the actions, e.g. to gather values without defining an action.
+	 * Numeric array items handled as a batch aren't passed to it.
+	 */
+	FORCEINLINE void SetVisitor(TFunction<void(const FProperty*, const void*)>&& InVisitor) { Visitor = MoveTemp(InVisitor); }
+
+	FORCEINLINE bool IsFinished() const { return Frames.IsEmpty(); }
+
+	/** Whether any action reported a modification so far. */
+	FORCEINLINE bool HasExecuted() const { return bExecutedSuccessfully; }
+
+	/** Path from the queued property to the one actions are invoked on, gathered from the parent links of the stack. */
+	FAruPropertyPath GetCurrentPath() const;
+
+	/** The traversal running on this thread, nullptr outside of Run. Lets filters query the current path. */
+	static const FAruPropertyTraversal* GetCurrent();
+
+private:
+	enum class EItemKind : uint8
+	{
+		None,
+		Element,
+		MapKey,
+		MapValue
+	};
+
+	struct FFrame
+	{
+		FProperty* Property = nullptr;
+		void* Value = nullptr;
+		int32 RemainTime = 0;
+		FAruTraversalDepth Depth;
+
+		// Stack index of the frame this one is nested in. Parents stay on the stack until their children are done.
+		int32 Parent = INDEX_NONE;
+
+		// Position inside the parent's array, set or map. For map pairs, the key the pair is selected by.
+		int32 ItemIndex = INDEX_NONE;
+		EItemKind ItemKind = EItemKind::None;
+		const void* ItemKey = nullptr;
+
+		// Object the value lives in, modified right before predicates may write to it.
+		UObject* Owner = nullptr;
+
+		// Where the path to this frame is in the run's property query, unused without one.
+		FAruPropertyQuery::FStateSet QueryStates = 0;
+
+		// Set once the nested properties have been pushed, the frame gets visited when it is on top again.
+		bool bExpanded = false;
+	};
+
+	void PushFrame(const FFrame& InFrame);
+	void PushProperties(
+		const UStruct* InType,
+		void* InContainer,
+		const int32 InParent,
+		const int32 InRemainTime,
+		const FAruTraversalDepth& InDepth,
+		const FAruPropertyQuery::FStateSet InQueryStates,
+		UObject* InOwner);
+	void ReverseFrom(const int32 InFirstFrame);
+
+	/** Hash of the path from the queued property to InFrameIndex, by the properties and item positions along it. */
+	uint32 HashPathTo(const int32 InFrameIndex) const;
+
+	void Expand(const int32 InFrameIndex);
+	void ExpandObject(const FFrame& InFrame, const int32 InFrameIndex, const FObjectPropertyBase* InProperty);
+	void ExpandStruct(const FFrame& InFrame, const int32 InFrameIndex, const FStructProperty* InProperty);
+	void ExpandArray(const FFrame& InFrame, const int32 InFrameIndex, const FArrayProperty* InProperty);
+	void ExpandMap(const FFrame& InFrame, const int32 InFrameIndex, const FMapProperty* InProperty);
+	void ExpandSet(const FFrame& InFrame, const int32 InFrameIndex, const FSetProperty* InProperty);
+	void Visit(const int32 InFrameIndex);
+
+	FAruProcessingState& State;
+
+	TFunction<void(const FProperty*, const void*)> Visitor;
+
+	TArray<FFrame> Frames;
+	int32 CurrentFrame = INDEX_NONE;
+	bool bExecutedSuccessfully = false;
+};
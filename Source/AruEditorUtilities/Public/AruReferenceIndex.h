@@ -0,0 +1,122 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "IO/IoHash.h"
+#include "Containers/Ticker.h"
+#include "UObject/UObjectGlobals.h"
+#include "AruReferenceIndex.generated.h"
+
+struct FAssetData;
+struct FObjectPostSaveContext;
+
+USTRUCT(BlueprintType)
+struct FAruIndexedReference
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FSoftObjectPath Asset;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FString PropertyPath;
+};
+
+/**
+ * Index from property values to the assets and property paths holding them, so "who uses this" queries
+ * don't have to load and process every asset. Indexed values are object and soft object references, names,
+ * strings, texts and gameplay tags, looked up case insensitively by a hash of their text.
+ *
+ * Indexing is opt in through StartIndexing. Packages are loaded asynchronously a few at a time and indexed once loaded,
+ * garbage is collected every few dozen packages so a full run doesn't keep the whole project in memory. The index is kept
+ * in the project's Saved directory, assets whose saved hash didn't change since are skipped, saved and removed assets are updated.
+ */
+UCLASS()
+class ARUEDITORUTILITIES_API UAruReferenceIndexSubsystem : public UEditorSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Queues every asset under InPackagePaths, e.g. "/Game", that isn't indexed at its current saved state. */
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	void StartIndexing(const TArray<FString>& InPackagePaths);
+
+	UFUNCTION(BlueprintCallable, CallInEditor)
+	void StopIndexing();
+
+	UFUNCTION(BlueprintPure)
+	bool IsIndexing() const { return !PendingPackages.IsEmpty() || NumLoadsInFlight > 0; }
+
+	UFUNCTION(BlueprintPure)
+	int32 GetNumPendingAssets() const { return PendingPackages.Num() + NumLoadsInFlight; }
+
+	/** Properties referencing InObject, through hard or soft references. */
+	UFUNCTION(BlueprintCallable)
+	TArray<FAruIndexedReference> FindReferencesToObject(const UObject* InObject) const;
+
+	/** Properties whose value reads InValue, e.g. a name, string, gameplay tag or object path. */
+	UFUNCTION(BlueprintCallable)
+	TArray<FAruIndexedReference> FindReferencesToValue(const FString& InValue) const;
+
+	/** Assets holding InValue somewhere, e.g. to load only those for a targeted ProcessAssets run. */
+	UFUNCTION(BlueprintCallable)
+	TArray<FSoftObjectPath> FindAssetsReferencingValue(const FString& InValue) const;
+
+private:
+	struct FIndexEntry
+	{
+		uint64 ValueHash = 0;
+		FString PropertyPath;
+
+		friend FArchive& operator<<(FArchive& Ar, FIndexEntry& Entry)
+		{
+			return Ar << Entry.ValueHash << Entry.PropertyPath;
+		}
+	};
+
+	struct FPackageRecord
+	{
+		FIoHash SavedHash;
+		FString AssetPath;
+		TArray<FIndexEntry> Entries;
+
+		friend FArchive& operator<<(FArchive& Ar, FPackageRecord& Record)
+		{
+			return Ar << Record.SavedHash << Record.AssetPath << Record.Entries;
+		}
+	};
+
+	bool Tick(float InDeltaTime);
+
+	void OnPackageLoaded(const FName& InPackageName, UPackage* InPackage, EAsyncLoadingResult::Type InResult);
+	void IndexPackage(const FName InPackageName);
+	void IndexObject(UObject* InAsset, FPackageRecord& OutRecord) const;
+	void AddRecord(const FName InPackageName, FPackageRecord&& InRecord);
+	void RemoveRecord(const FName InPackageName);
+	void EnqueuePackage(const FName InPackageName);
+
+	void OnPackageSaved(const FString& InFilename, UPackage* InPackage, FObjectPostSaveContext InContext);
+	void OnAssetRemoved(const FAssetData& InAssetData);
+
+	bool LoadIndex();
+	bool SaveIndex();
+	static FString GetIndexFilename();
+
+	TMap<FName, FPackageRecord> Packages;
+	TMultiMap<uint64, FName> PackagesByValue;
+
+	// Taken from the back, PendingPackageSet keeps a package from being queued twice.
+	TArray<FName> PendingPackages;
+	TSet<FName> PendingPackageSet;
+
+	int32 NumLoadsInFlight = 0;
+
+	// Packages loaded for indexing since the last garbage collection.
+	int32 NumLoadedSinceGC = 0;
+
+	bool bIndexDirty = false;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,87 @@
+﻿#pragma once
+
+#include "AruTypes.h"
+#include "Internationalization/Regex.h"
+
+/** How the patterns of a string filter are compared against values. */
+struct FAruStringMatchOptions
+{
+	EAruStringPatternType PatternType = EAruStringPatternType::Plain;
+
+	// Whether a pattern has to match the whole value, otherwise any part of it.
+	bool bWholeString = false;
+	bool bCaseSensitive = false;
+};
+
+/** Patterns compiled once and matched against values without allocating, except by regex. A value matches if any pattern does. */
+class ARUEDITORUTILITIES_API FAruStringPatterns
+{
+public:
+	/** Empty patterns are skipped. */
+	static FAruStringPatterns Compile(TConstArrayView<FString> InPatterns, const FAruStringMatchOptions& InOptions);
+
+	bool Matches(const FString& InValue) const;
+
+	FORCEINLINE bool IsEmpty() const { return Patterns.IsEmpty(); }
+
+private:
+	struct FPattern
+	{
+		FString Text;
+		TOptional<FRegexPattern> Regex;
+	};
+
+	TArray<FPattern, TInlineAllocator<1>> Patterns;
+	FAruStringMatchOptions Options;
+};
+
+/**
+ * The patterns of a filter compiled once per parameter set, references to parameters get resolved first.
+ * Bag addresses must stay stable until Reset, which owners call from BeginProcessing.
+ */
+struct ARUEDITORUTILITIES_API FAruStringMatcher
+{
+	const FAruStringPatterns& Get(
+		const FInstancedPropertyBag& InParameters,
+		const FString& InSource,
+		TConstArrayView<FString> InAdditionalSources,
+		const FAruStringMatchOptions& InOptions) const;
+
+	FORCEINLINE void Reset() const { Entries.Reset(); }
+
+private:
+	mutable TArray<TPair<const FInstancedPropertyBag*, FAruStringPatterns>, TInlineAllocator<1>> Entries;
+};
+
+/**
+ * Matches names against the pattern of a filter, compiled once per parameter set, without building strings for them.
+ * Whole-name plain patterns compare FNames, other patterns cache their outcome per name for the run.
+ * Names always compare case-insensitively, as FNames do.
+ */
+struct ARUEDITORUTILITIES_API FAruNameMatcher
+{
+	bool Matches(const FInstancedPropertyBag& InParameters, const FName InName, const FString& InSource, const FAruStringMatchOptions& InOptions) const;
+
+	/** Same as above for names only known as strings, e.g. display names, which are matched as is. */
+	bool Matches(const FInstancedPropertyBag& InParameters, const FString& InName, const FString& InSource, const FAruStringMatchOptions& InOptions) const;
+
+	FORCEINLINE void Reset() const { Entries.Reset(); }
+
+private:
+	struct FEntry
+	{
+		const FInstancedPropertyBag* Parameters = nullptr;
+		FAruStringPatterns Patterns;
+
+		// Set for whole-name plain patterns, which are matched by FName. ExactName stays NAME_None while no name like
+		// the pattern exists and is looked up again then, names may be created later in the run, e.g. by loading a package.
+		bool bMatchExactName = false;
+		FString ExactSource;
+		FName ExactName;
+		TMap<FName, bool> Outcomes;
+	};
+
+	FEntry& FindOrAddEntry(const FInstancedPropertyBag& InParameters, const FString& InSource, const FAruStringMatchOptions& InOptions) const;
+
+	mutable TArray<FEntry, TInlineAllocator<1>> Entries;
+};
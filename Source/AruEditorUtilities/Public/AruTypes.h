@@ -41,6 +41,40 @@ enum class EAruNameCompareOp : uint8
 	MatchAll
 };
 
+/** How the condition strings of string and name filters are interpreted. */
+UENUM(BlueprintType)
+enum class EAruStringPatternType : uint8
+{
+	Plain,
+	// '*' matches any run of characters, '?' any single one.
+	Wildcard,
+	Regex
+};
+
+/**
+ * Resolved forms of a parameterized string, one per parameter set, so "{Key}" parameter lookups happen once per run instead of per property.
+ * Bag addresses must stay stable until Reset, which owners call from BeginProcessing.
+ */
+struct ARUEDITORUTILITIES_API FAruResolvedString
+{
+	const FString& Resolve(const FInstancedPropertyBag& InParameters, const FString& InSource) const;
+
+	FORCEINLINE void Reset() const { Entries.Reset(); }
+
+private:
+	mutable TArray<TPair<const FInstancedPropertyBag*, FString>, TInlineAllocator<1>> Entries;
+};
+
+class FAruProgramBuilder;
+
+/** Which conditions of an action to evaluate, so the ones ignoring the parameters can be shared between parameter sets. */
+enum class EAruConditionScope : uint8
+{
+	All,
+	ParameterFree,
+	Parameterized
+};
+
 USTRUCT(BlueprintType)
 struct FAruFilter
 {
@@ -50,6 +84,55 @@ public:
 	virtual ~FAruFilter() {}
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const { return bInverseCondition; }
 
+	/**
+	 * Evaluates the condition over InNum contiguous values of InElementProperty, e.g. the items of an array.
+	 * Only values whose bit is still set in InOutMatches are evaluated, bits of values that don't meet the condition get cleared.
+	 * The default implementation calls IsConditionMet per value, filters with a cheaper vectorized form should override it.
+	 */
+	virtual void IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const;
+
+	/**
+	 * Whether the filter evaluates properties of the given type at all, filters return bInverseCondition for any other type.
+	 * Queried once per property type to skip actions that can't run on it, so the answer must not depend on values.
+	 * InStructType is the struct of struct properties and nullptr for every other property.
+	 */
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const { return true; }
+
+	FORCEINLINE bool CanBeMetBy(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const
+	{
+		return bInverseCondition || IsApplicableTo(InFieldClass, InStructType);
+	}
+
+	/**
+	 * Whether the outcome depends on more than the property and its value, e.g. on where the property sits in the asset.
+	 * Outcomes of such filters are never reused for identical values.
+	 */
+	virtual bool DependsOnContext() const { return false; }
+
+	/**
+	 * Whether the outcome may change with the run parameters, e.g. a compared string referencing one.
+	 * Outcomes of other filters are shared between the parameter sets of a matrix run.
+	 */
+	virtual bool DependsOnParameters() const { return false; }
+
+	/**
+	 * Emits native instructions equivalent to IsConditionMet into an action's compiled program, see FAruActionProgram.
+	 * Returns false if the filter has no native form, the program calls IsConditionMet then.
+	 */
+	virtual bool Lower(FAruProgramBuilder& InBuilder) const { return false; }
+
+	/**
+	 * Rough relative cost of one IsConditionMet call, a plain value compare costs 1.
+	 * Condition groups evaluate cheaper children first so short-circuiting skips the expensive ones.
+	 */
+	virtual int32 GetEstimatedCost() const { return 1; }
+
+	/**
+	 * Called once before a processing run starts.
+	 * Filters holding run-scoped caches should reset them here, filters wrapping other filters should forward the call.
+	 */
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const {}
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category=Config, meta=(AdvancedClassDisplay))
 	bool bInverseCondition = false;
@@ -77,8 +160,54 @@ public:
 	 *                          false if no changes were made or the operation failed.
 	 */
 	virtual bool Execute(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const { return true; }
+
+	/**
+	 * Executes the operation on every value of a contiguous span whose bit is set in InMatches.
+	 * 
+	 * @param InElementProperty The property describing each value of the span.
+	 * @param InValues          Pointer to the first value, values are InElementProperty->GetSize() bytes apart.
+	 * @param InNum             Number of values in the span.
+	 * @param InMatches         One bit per value, cleared bits are skipped.
+	 * @param InParameters      Container holding runtime parameters/operators for the operation.
+	 * 
+	 * @return                  Number of values the operation succeeded on.
+	 */
+	virtual int32 ExecuteBatch(const FProperty* InElementProperty, void* InValues, const int32 InNum, const TBitArray<>& InMatches, const FInstancedPropertyBag& InParameters) const;
+
+	/**
+	 * Emits guards skipping Execute in an action's compiled program when it would change nothing, see FAruActionProgram.
+	 * Execute itself is always kept, so its writes and reporting stay the same.
+	 */
+	virtual void LowerGuards(FAruProgramBuilder& InBuilder) const {}
+
+	/**
+	 * Called once before a processing run starts.
+	 * Predicates holding run-scoped caches should reset them here, predicates wrapping other filters or predicates should forward the call.
+	 */
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const {}
 };
 
+namespace Aru
+{
+	template <typename StructType>
+	void BeginProcessing(const TInstancedStruct<StructType>& InStruct, const FInstancedPropertyBag& InParameters)
+	{
+		if (const StructType* StructPtr = InStruct.template GetPtr<StructType>())
+		{
+			StructPtr->BeginProcessing(InParameters);
+		}
+	}
+
+	template <typename StructType>
+	void BeginProcessing(const TArray<TInstancedStruct<StructType>>& InStructs, const FInstancedPropertyBag& InParameters)
+	{
+		for (const TInstancedStruct<StructType>& Struct : InStructs)
+		{
+			BeginProcessing(Struct, InParameters);
+		}
+	}
+}
+
 USTRUCT(BlueprintType)
 struct FAruActionDefinition
 {
@@ -87,6 +216,31 @@ struct FAruActionDefinition
 public:
 	bool Invoke(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const;
 
+	/**
+	 * The two phases of Invoke, so the outcome of the conditions can be cached and replayed.
+	 * InScope restricts which conditions are evaluated, see FAruFilter::DependsOnParameters.
+	 */
+	bool AreConditionsMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters, const EAruConditionScope InScope = EAruConditionScope::All) const;
+	bool ExecutePredicates(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const;
+
+	/** Same as Invoke, over InNum contiguous values of InElementProperty. */
+	bool InvokeBatch(const FProperty* InElementProperty, void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters) const;
+
+	/**
+	 * The two phases of InvokeBatch, OutMatches gets a set bit per value meeting every condition and false is returned if none does.
+	 * ExecutePredicatesBatch returns the number of values the predicates changed.
+	 */
+	bool AreConditionsMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& OutMatches) const;
+	int32 ExecutePredicatesBatch(const FProperty* InElementProperty, void* InValues, const int32 InNum, const TBitArray<>& InMatches, const FInstancedPropertyBag& InParameters) const;
+
+	void BeginProcessing(const FInstancedPropertyBag& InParameters) const;
+
+	/** False if some condition can never be met by properties of the given type. */
+	bool CanApplyTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const;
+
+	/** Whether some condition depends on more than the property and its value, see FAruFilter::DependsOnContext. */
+	bool DependsOnContext() const;
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="Aru Editor Utilities", meta=(ExcludeBaseStruct))
 	TArray<TInstancedStruct<FAruFilter>> ActionConditions;
@@ -145,6 +299,56 @@ public:
 	TArray<FAruActionDefinition> ActionDefinitions;
 };
 
+/** One config of a fused run, its actions see its own parameters and only reach properties within its own search depth. */
+USTRUCT(BlueprintType)
+struct FAruActionConfigRun
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	TObjectPtr<UAruActionConfigData> ConfigData;
+
+	UPROPERTY(EditAnywhere)
+	FInstancedPropertyBag Parameters;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 MaxSearchDepth = 5;
+};
+
+/** Limits applied on top of MaxSearchDepth, per kind of step the traversal takes. */
+USTRUCT(BlueprintType)
+struct FAruTraversalPolicy
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(InlineEditConditionToggle))
+	bool bLimitObjectHops = false;
+
+	/** How many object references may be followed from the processed asset. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bLimitObjectHops", ClampMin=0))
+	int32 MaxObjectHops = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(InlineEditConditionToggle))
+	bool bLimitStructNesting = false;
+
+	/** How many structs, instanced structs included, may be nested. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bLimitStructNesting", ClampMin=0))
+	int32 MaxStructNesting = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(InlineEditConditionToggle))
+	bool bLimitContainerNesting = false;
+
+	/** How many arrays, maps and sets may be nested. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bLimitContainerNesting", ClampMin=0))
+	int32 MaxContainerNesting = 2;
+
+	/** Whether object references into other packages are followed, e.g. references to other assets. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bFollowExternalReferences = true;
+};
+
 USTRUCT(BlueprintType)
 struct FAruProcessConfig
 {
@@ -154,6 +358,60 @@ public:
 	UPROPERTY(EditAnywhere)
 	FInstancedPropertyBag Parameters;
 
+	/**
+	 * Run the actions once per parameter set instead of once with Parameters, all in one traversal, e.g. to apply per-region values.
+	 * Conditions that don't reference parameters are evaluated once per property for every set. Parameters still resolves the property query.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay)
+	TArray<FInstancedPropertyBag> ParameterMatrix;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	int32 MaxSearchDepth = 5;
+
+	/** Only follow object references into subobjects of the processed asset, e.g. instanced or default subobjects. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bOnlyTraverseOwnedObjects = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FAruTraversalPolicy TraversalPolicy;
+
+	/**
+	 * Record the run's edits in one undo transaction. Turning it off skips the undo buffer copies, e.g. for huge headless runs,
+	 * edited objects still get their packages marked dirty.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bUndoable = true;
+
+	/** Save the packages the run modified once it's done, instead of leaving them dirty. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bSaveModifiedPackages = false;
+
+	/** Check out every package to save in one source control operation first, if source control is enabled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta=(EditCondition="bSaveModifiedPackages"))
+	bool bCheckOutModifiedPackages = true;
+
+	/** Packages whose file writes may be in flight at once, a larger batch overlaps more I/O but holds more memory. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, meta=(EditCondition="bSaveModifiedPackages", ClampMin=1))
+	int32 SaveBatchSize = 64;
+
+	/**
+	 * Evaluate the conditions once per distinct value of each struct property and replay the outcome for identical copies,
+	 * e.g. duplicated instanced struct payloads. Values are compared in full, their hash only narrows down the candidates.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bMemoizeStructConditions = false;
+
+	/**
+	 * Compile each action into a flat instruction program once per run, common filters and setters then run without virtual calls.
+	 * Filters and predicates with no native form are still called as usual.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bCompileActions = true;
+
+	/**
+	 * Only invoke actions on properties at paths matching this query, e.g. "Effects[*].Magnitude" or "**.Damage".
+	 * Branches that can't lead to a match are skipped entirely. Empty processes every property.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FString PropertyQuery;
 };
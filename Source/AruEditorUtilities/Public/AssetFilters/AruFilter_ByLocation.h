@@ -0,0 +1,36 @@
+﻿#pragma once
+#include "AruTypes.h"
+#include "AruPropertyQuery.h"
+#include "AruFilter_ByLocation.generated.h"
+
+USTRUCT(BlueprintType, DisplayName="Check Property Location")
+struct FAruFilter_ByPropertyLocation : public FAruFilter
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruFilter_ByPropertyLocation() override {};
+
+	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
+	virtual bool DependsOnContext() const override { return true; }
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override { return 8; }
+
+protected:
+	/** Path query from the processed asset, e.g. "Abilities[*].Effects" or "**.Damage", see FAruPropertyQuery. */
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	FString PropertyLocation{"Path.To.Property"};
+
+	/** Also met by everything nested below the location, not only by the property at it. */
+	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
+	bool bIncludeNestedProperties = true;
+
+private:
+	static FString GetCompactName() { return {"CheckPropertyLocation"}; }
+
+	FAruResolvedString ResolvedLocations;
+
+	// Compiled on first use per resolved location, the location may reference run parameters and a run may use several parameter sets.
+	mutable TMap<FString, FAruPropertyQuery> CompiledLocations;
+};
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "AruTypes.h"
+#include "AruStringMatcher.h"
 #include "AruFilter_ByName.generated.h"
 
 USTRUCT(BlueprintType, DisplayName="Check Property Name")
@@ -11,6 +12,9 @@ public:
 	virtual ~FAruFilter_ByName() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override { return 2; }
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly)
@@ -18,6 +22,16 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly)
 	FString PropertyName{"None"};
+
+	UPROPERTY(EditDefaultsOnly)
+	EAruStringPatternType PatternType = EAruStringPatternType::Plain;
+
+private:
+	/** Building a display name looks up metadata and formats text, so it's done once per property and run. */
+	const FString& GetDisplayName(const FProperty* InProperty) const;
+
+	FAruNameMatcher Matcher;
+	mutable TMap<const FProperty*, FString> DisplayNames;
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Object Name")
@@ -29,6 +43,10 @@ public:
 	virtual ~FAruFilter_ByObjectName() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override { return 2; }
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -36,4 +54,10 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	FString ObjectName{"None"};
+
+	UPROPERTY(EditDefaultsOnly)
+	EAruStringPatternType PatternType = EAruStringPatternType::Plain;
+
+private:
+	FAruNameMatcher Matcher;
 };
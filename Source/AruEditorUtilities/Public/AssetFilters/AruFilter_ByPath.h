@@ -11,6 +11,9 @@ public:
 	virtual ~FAruFilter_ByAssetPath() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override { return 2; }
 
 protected:
 	UPROPERTY(EditDefaultsOnly)
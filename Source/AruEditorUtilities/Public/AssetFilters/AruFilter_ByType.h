@@ -11,6 +11,7 @@ public:
 	virtual ~FAruFilter_ByObjectType() override {}
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly)
@@ -26,6 +27,7 @@ public:
 	virtual ~FAruFilter_ByStructType() override {}
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly)
@@ -41,6 +43,7 @@ public:
 	virtual ~FAruFilter_ByInstancedStructType() override {}
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly)
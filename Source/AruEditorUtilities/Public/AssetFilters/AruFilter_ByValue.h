@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "AruTypes.h"
+#include "AruNumericKernels.h"
+#include "AruStringMatcher.h"
 #include "GameplayTagContainer.h"
 #include "AruFilter_ByValue.generated.h"
 
@@ -12,13 +14,20 @@ public:
 	virtual ~FAruFilter_ByNumericValue() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool Lower(FAruProgramBuilder& InBuilder) const override;
+	virtual void IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
-	float ConditionValue = 0.f;
+	double ConditionValue = 0.0;
 
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	EAruNumericCompareOp CompareOp = EAruNumericCompareOp::Equip;
+
+private:
+	mutable Aru::Numeric::FCompareBinding Binding;
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Numeric Range")
@@ -30,10 +39,17 @@ public:
 	virtual ~FAruFilter_InRange() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool Lower(FAruProgramBuilder& InBuilder) const override;
+	virtual void IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	FVector2D ConditionValue{0.f};
+
+private:
+	mutable Aru::Numeric::FRangeBinding Binding;
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Boolean Value")
@@ -45,6 +61,8 @@ public:
 	virtual ~FAruFilter_ByBoolean() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool Lower(FAruProgramBuilder& InBuilder) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -63,6 +81,9 @@ public:
 	virtual ~FAruFilter_ByObject() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool Lower(FAruProgramBuilder& InBuilder) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -70,6 +91,12 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	EAruBooleanCompareOp CompareOp = EAruBooleanCompareOp::Is;
+
+private:
+	// Soft references are compared by path, ConditionValue's own path is only built once per run.
+	const FSoftObjectPath& GetConditionPath() const;
+
+	mutable TOptional<FSoftObjectPath> ConditionPath;
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Enumeration Value")
@@ -81,6 +108,8 @@ public:
 	virtual ~FAruFilter_ByEnum() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -88,6 +117,30 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	EAruBooleanCompareOp CompareOp = EAruBooleanCompareOp::Is;
+
+	/** Enumerators matched as well as ConditionValue, "Is" then means any of them and "Not" none of them. */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay)
+	TArray<FString> AdditionalConditionValues;
+
+private:
+	/** The condition enumerators resolved for one enum, a bit per value for values from 0 to 63. */
+	struct FResolvedValues
+	{
+		const UEnum* Enum = nullptr;
+		uint64 ValueMask = 0;
+		TArray<int64, TInlineAllocator<1>> OtherValues;
+
+		FORCEINLINE bool IsEmpty() const { return ValueMask == 0 && OtherValues.IsEmpty(); }
+		FORCEINLINE bool Contains(const int64 InValue) const
+		{
+			return InValue >= 0 && InValue < 64 ? (ValueMask & (uint64{1} << InValue)) != 0 : OtherValues.Contains(InValue);
+		}
+	};
+
+	/** Names are looked up once per enum and run. */
+	const FResolvedValues& ResolveValues(const UEnum* InEnum) const;
+
+	mutable TArray<FResolvedValues, TInlineAllocator<1>> ResolvedValues;
 };
 
 USTRUCT(BlueprintType, DisplayName="Check String Value")
@@ -99,6 +152,10 @@ public:
 	virtual ~FAruFilter_ByString() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override { return 4; }
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -109,6 +166,18 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	bool bCaseSensitive = false;
+
+	UPROPERTY(EditDefaultsOnly)
+	EAruStringPatternType PatternType = EAruStringPatternType::Plain;
+
+	/** Matched as well as ConditionValue, the condition is met if any of them matches. */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay)
+	TArray<FString> AdditionalConditionValues;
+
+private:
+	const FAruStringPatterns& GetPatterns(const FInstancedPropertyBag& InParameters) const;
+
+	FAruStringMatcher Matcher;
 };
 
 USTRUCT(BlueprintType, DisplayName="Check Text Value")
@@ -120,6 +189,10 @@ public:
 	virtual ~FAruFilter_ByText() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override { return 4; }
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -130,6 +203,50 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	bool bCaseSensitive = false;
+
+	UPROPERTY(EditDefaultsOnly)
+	EAruStringPatternType PatternType = EAruStringPatternType::Plain;
+
+	/** Matched as well as ConditionValue, the condition is met if any of them matches. */
+	UPROPERTY(EditDefaultsOnly, AdvancedDisplay)
+	TArray<FString> AdditionalConditionValues;
+
+private:
+	const FAruStringPatterns& GetPatterns(const FInstancedPropertyBag& InParameters) const;
+
+	FAruStringMatcher Matcher;
+};
+
+/**
+ * Flattened form of a FGameplayTagQuery.
+ * Every distinct tag referenced by the query owns one bit, so each expression reduces to a mask test
+ * against the set of query tags matched by the evaluated value.
+ */
+struct FAruCompiledGameplayTagQuery
+{
+	/** Returns false if the query can't be represented, e.g. it references more tags than the mask can hold. */
+	bool Compile(const FGameplayTagQuery& InQuery);
+	void Reset();
+
+	FORCEINLINE bool IsValid() const { return Nodes.Num() > 0; }
+
+	bool Matches(const FGameplayTag& InTag) const;
+	bool Matches(const FGameplayTagContainer& InTags) const;
+
+private:
+	struct FNode
+	{
+		EGameplayTagQueryExprType ExprType = EGameplayTagQueryExprType::Undefined;
+		uint64 TagMask = 0;
+		int32 FirstChild = INDEX_NONE;
+		int32 NumChildren = 0;
+	};
+
+	int32 AddExpression(const FGameplayTagQueryExpression& InExpression);
+	bool EvaluateNode(const int32 NodeIndex, const uint64 MatchedMask, const uint64 ExactMask) const;
+
+	TArray<FGameplayTag> Tags;
+	TArray<FNode> Nodes;
 };
 
 USTRUCT(BlueprintType, DisplayName="Check GameplayTags")
@@ -141,8 +258,22 @@ public:
 	virtual ~FAruFilter_ByGameplayTagContainer() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual int32 GetEstimatedCost() const override { return 4; }
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
 	FGameplayTagQuery TagQuery;
+
+private:
+	bool MatchesTag(const FGameplayTag& InTag) const;
+	bool MatchesTags(const FGameplayTagContainer& InTags) const;
+	void CompileQuery() const;
+
+	// Query results only depend on the evaluated tags, so they are memoized for the whole run.
+	mutable bool bQueryCompiled = false;
+	mutable FAruCompiledGameplayTagQuery CompiledQuery;
+	mutable TMap<FGameplayTag, bool> CachedTagResults;
+	mutable TMultiMap<uint32, TPair<FGameplayTagContainer, bool>> CachedContainerResults;
 };
@@ -0,0 +1,73 @@
+﻿#pragma once
+#include "AruTypes.h"
+#include "AruFilter_Logic.generated.h"
+
+/** Children of the condition groups, evaluated cheapest first so short-circuiting skips the expensive ones. */
+USTRUCT(meta=(Hidden))
+struct FAruFilter_Group : public FAruFilter
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruFilter_Group() override {}
+
+	virtual bool DependsOnContext() const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
+
+protected:
+	TConstArrayView<const FAruFilter*> GetSortedConditions() const;
+
+	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
+	TArray<TInstancedStruct<FAruFilter>> Conditions;
+
+private:
+	// Valid children by estimated cost, ties keep their order. Rebuilt every run as the children may have been edited.
+	mutable TArray<const FAruFilter*> SortedConditions;
+	mutable bool bSorted = false;
+};
+
+USTRUCT(BlueprintType, DisplayName="Match Any Condition")
+struct FAruFilter_Any : public FAruFilter_Group
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruFilter_Any() override {}
+
+	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+};
+
+USTRUCT(BlueprintType, DisplayName="Match All Conditions")
+struct FAruFilter_All : public FAruFilter_Group
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruFilter_All() override {}
+
+	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool IsApplicableTo(const FFieldClass* InFieldClass, const UScriptStruct* InStructType) const override;
+	virtual void IsConditionMetBatch(const FProperty* InElementProperty, const void* InValues, const int32 InNum, const FInstancedPropertyBag& InParameters, TBitArray<>& InOutMatches) const override;
+};
+
+USTRUCT(BlueprintType, DisplayName="Not")
+struct FAruFilter_Not : public FAruFilter
+{
+	GENERATED_BODY()
+
+public:
+	virtual ~FAruFilter_Not() override {}
+
+	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual bool DependsOnContext() const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
+	TInstancedStruct<FAruFilter> Condition;
+};
@@ -11,6 +11,10 @@ public:
 	virtual ~FAruFilter_PathToProperty() override {};
 
 	virtual bool IsConditionMet(const FProperty* InProperty, const void* InValue, const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
+	virtual bool DependsOnContext() const override;
+	virtual bool DependsOnParameters() const override;
+	virtual int32 GetEstimatedCost() const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -14,6 +14,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
@@ -36,6 +37,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
@@ -57,6 +59,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
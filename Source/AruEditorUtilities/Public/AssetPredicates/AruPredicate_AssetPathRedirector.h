@@ -2,6 +2,9 @@
 #include "AruTypes.h"
 #include "AruPredicate_AssetPathRedirector.generated.h"
 
+struct FAssetData;
+class IAssetRegistry;
+
 USTRUCT(BlueprintType, DisplayName="Redirect Asset Path")
 struct FAruPredicate_AssetPathRedirector : public FAruPredicate
 {
@@ -19,5 +22,23 @@ public:
 		const FInstancedPropertyBag& InParameters) const override;
 
 private:
+	/** Rewrites a soft object or soft class reference by path, checking the new asset exists in the asset registry instead of loading it. */
+	bool RedirectSoftReference(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const;
+
+	FString RedirectPath(const FString& InPath, const FInstancedPropertyBag& InParameters) const;
+
+	static bool IsSameOrDerivedClass(const FAssetData& InAsset, const FAssetData& InBaseAsset);
+
+	/** Whether InClassPath is InBaseClassPath or derives from it, unloaded blueprint classes are checked through their asset tags. */
+	static bool IsSameOrDerivedClass(const IAssetRegistry& InAssetRegistry, const FSoftObjectPath& InClassPath, const FSoftObjectPath& InBaseClassPath);
+
+	/** TSoftClassPtr or FSoftClassPath, their paths name a class rather than an asset. */
+	static bool IsClassReference(const FProperty* InProperty);
+
+	static bool DoesClassExist(const IAssetRegistry& InAssetRegistry, const FSoftObjectPath& InClassPath);
+
+	/** The blueprint asset generating InClassPath, invalid for native or missing classes. */
+	static FAssetData FindBlueprintAsset(const IAssetRegistry& InAssetRegistry, const FSoftObjectPath& InClassPath);
+
 	static FString GetCompactName() { return {"RedirectPath"}; }
 };
@@ -44,3 +44,93 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 };
+
+USTRUCT(BlueprintType, DisplayName="Add GameplayTags")
+struct FAruPredicate_AddGameplayTags : public FAruPredicate
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditDefaultsOnly)
+	FGameplayTagContainer TagsToAdd;
+
+public:
+	virtual ~FAruPredicate_AddGameplayTags() override {}
+
+	virtual bool Execute(
+		const FProperty* InProperty,
+		void* InValue,
+		const FInstancedPropertyBag& InParameters) const override;
+
+private:
+	static FString GetCompactName() { return {"AddGameplayTags"}; }
+};
+
+USTRUCT(BlueprintType, DisplayName="Remove GameplayTags")
+struct FAruPredicate_RemoveGameplayTags : public FAruPredicate
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditDefaultsOnly)
+	FGameplayTagContainer TagsToRemove;
+
+	// Also remove tags that are children of the configured tags, e.g. removing 'A.B' removes 'A.B.C'.
+	UPROPERTY(EditDefaultsOnly)
+	bool bRemoveChildTags = false;
+
+public:
+	virtual ~FAruPredicate_RemoveGameplayTags() override {}
+
+	virtual bool Execute(
+		const FProperty* InProperty,
+		void* InValue,
+		const FInstancedPropertyBag& InParameters) const override;
+
+private:
+	bool ShouldRemove(const FGameplayTag& InTag) const;
+
+	static FString GetCompactName() { return {"RemoveGameplayTags"}; }
+};
+
+/**
+ * Renames tags in place using a redirect table.
+ * Works on FGameplayTag, FGameplayTagContainer and FGameplayTagQuery, only values that reference a redirected tag are touched.
+ */
+USTRUCT(BlueprintType, DisplayName="Rename GameplayTags")
+struct FAruPredicate_RenameGameplayTags : public FAruPredicate
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditDefaultsOnly)
+	TMap<FGameplayTag, FGameplayTag> Redirects;
+
+	// Also rename child tags, e.g. redirecting 'A.B' to 'C.D' renames 'A.B.E' to 'C.D.E' if that tag exists.
+	UPROPERTY(EditDefaultsOnly)
+	bool bRenameChildTags = false;
+
+public:
+	virtual ~FAruPredicate_RenameGameplayTags() override {}
+
+	virtual bool Execute(
+		const FProperty* InProperty,
+		void* InValue,
+		const FInstancedPropertyBag& InParameters) const override;
+
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
+
+private:
+	/** Returns the redirected tag, or an invalid tag if InTag is not redirected. */
+	FGameplayTag FindRedirect(const FGameplayTag& InTag) const;
+
+	bool RenameTag(FGameplayTag& InOutTag) const;
+	bool RenameTags(FGameplayTagContainer& InOutTags) const;
+	bool RenameTags(FGameplayTagQuery& InOutQuery) const;
+	void RenameTags(FGameplayTagQueryExpression& InOutExpression) const;
+
+	static FString GetCompactName() { return {"RenameGameplayTags"}; }
+
+	// Resolved redirects for every tag seen during the run, invalid entries mean 'not redirected'.
+	mutable TMap<FGameplayTag, FGameplayTag> CachedRedirects;
+};
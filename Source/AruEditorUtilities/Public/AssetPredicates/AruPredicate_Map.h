@@ -14,6 +14,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
@@ -37,6 +38,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
@@ -60,6 +62,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
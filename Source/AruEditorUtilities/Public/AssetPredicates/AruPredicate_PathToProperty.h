@@ -13,6 +13,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, SimpleDisplay)
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "AruTypes.h"
 #include "StructUtils/PropertyBag.h"
+#include "Misc/TVariant.h"
 #include "AruPredicate_PropertySetter.generated.h"
 
 #define LOCTEXT_NAMESPACE "FAruEditorUtilitiesModule"
@@ -22,6 +23,7 @@ struct FAruPredicate_PropertySetter : public FAruPredicate
 public:
 	virtual ~FAruPredicate_PropertySetter() override {};
 	virtual const UScriptStruct* GetScriptedStruct() const { return StaticStruct(); }
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(DisplayPriority = 0))
@@ -45,21 +47,78 @@ protected:
 protected:
 	virtual FString GetCompactName() const { return {"ShouldBeOverride"}; }
 
+	/** ParameterName read from one parameter set, kept until the next run. */
+	struct FParameterSlot
+	{
+		const FInstancedPropertyBag* Parameters = nullptr;
+		const UField* ValueType = nullptr;
+		FString ResolvedName;
+
+		// Empty if the parameter couldn't be read as the requested type.
+		TVariant<FEmptyVariantState, bool, double, int64, uint8, FString, FText, FName, UObject*, FStructView> Value;
+	};
+
+	/**
+	 * The slot ParameterName is bound to in InParameters. The name is resolved and the value read and converted with InRead
+	 * the first time each parameter set shows up during a run, later calls skip both. InValueType keeps enum and struct reads apart.
+	 */
+	template <typename T, typename ReadType>
+	const FParameterSlot& BindParameter(const FInstancedPropertyBag& InParameters, ReadType&& InRead, const UField* InValueType = nullptr) const
+	{
+		bool bAdded = false;
+		FParameterSlot& Slot = FindOrAddParameterSlot(InParameters, InValueType, bAdded);
+		if (bAdded)
+		{
+			TValueOrError<T, EPropertyBagResult> Result = InRead(FName{Slot.ResolvedName});
+			if (Result.HasValue())
+			{
+				Slot.Value.template Emplace<T>(Result.StealValue());
+			}
+		}
+		return Slot;
+	}
+
+	/**
+	 * The source value, unset if it can't be found or doesn't match. With InTargetProperty the source property must be of the
+	 * same class as the target too, its value gets copied into the target as is.
+	 */
 	template <typename T, typename = std::enable_if_t<std::is_base_of_v<FProperty, std::decay_t<T>>>>
-	TOptional<const void*> GetNewValueBySourceType(const FInstancedPropertyBag& InParameters, const UStruct* TypeToCheck = nullptr) const
+	TOptional<const void*> GetNewValueBySourceType(
+		const FInstancedPropertyBag& InParameters,
+		const UStruct* TypeToCheck = nullptr,
+		const FProperty* InTargetProperty = nullptr) const
+	{
+		if (ValueSource == EAruValueSource::Parameters)
+		{
+			return {};
+		}
+		return BindSource(T::StaticClass(), InParameters, TypeToCheck, InTargetProperty != nullptr ? InTargetProperty->GetClass() : nullptr).Value;
+	}
+
+	/**
+	 * Reads the numeric source value into OutValue converted to InProperty's own type, the source may be stored with
+	 * another width or numeric kind. Returns false if the source can't be found, the warning is logged once when binding it.
+	 */
+	bool GetNewNumericValue(const FNumericProperty* InProperty, const FInstancedPropertyBag& InParameters, uint64& OutValue) const;
+
+	/**
+	 * Copies InNewValue into InValue unless both are already identical, returns whether the value changed.
+	 * Setters don't report identical values as executed, so rerunning a config modifies nothing.
+	 * InNewValue must hold InProperty's own type, values of other widths are converted into a temporary first.
+	 */
+	static bool WriteIfChanged(const FProperty* InProperty, void* InValue, const void* InNewValue)
 	{
-		switch (ValueSource)
+		if (InProperty->Identical(InValue, InNewValue, PPF_None))
 		{
-		case EAruValueSource::Value: return GetValueFromStructProperty(T::StaticClass(), TypeToCheck);
-		case EAruValueSource::Object: return GetValueFromObjectAsset(T::StaticClass(), InParameters, TypeToCheck);
-		case EAruValueSource::DataTable: return GetValueFromDataTable(T::StaticClass(), InParameters, TypeToCheck);
-		case EAruValueSource::Parameters: return {};
+			return false;
 		}
-		return {};
+
+		InProperty->CopySingleValue(InValue, InNewValue);
+		return true;
 	}
 
 	template <typename T, typename = std::enable_if_t<std::is_base_of_v<FProperty, std::decay_t<T>>>>
-	bool SetPropertyValue(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters) const
+	bool SetPropertyValue(const FProperty* InProperty, void* InValue, const FInstancedPropertyBag& InParameters, bool& bOutChanged) const
 	{
 		if (InProperty == nullptr || InValue == nullptr)
 		{
@@ -81,7 +140,7 @@ protected:
 			return false;
 		}
 
-		TOptional<const void*> OptionalValue = GetNewValueBySourceType<T>(InParameters);
+		TOptional<const void*> OptionalValue = GetNewValueBySourceType<T>(InParameters, nullptr, InProperty);
 		if (!OptionalValue.IsSet())
 		{
 			FMessageLog{FName{"AruEditorUtilitiesModule"}}.Warning(
@@ -103,21 +162,59 @@ protected:
 			return false;
 		}
 
-		SubProperty->CopyCompleteValue(InValue, PendingValue);
+		bOutChanged = WriteIfChanged(SubProperty, InValue, PendingValue);
 		return true;
 	}
 
 private:
-	TOptional<const void*> GetValueFromStructProperty(const FFieldClass* SourceProperty, const UStruct* SourceType = nullptr) const;
+	FParameterSlot& FindOrAddParameterSlot(const FInstancedPropertyBag& InParameters, const UField* InValueType, bool& bOutAdded) const;
+
+	// Bag addresses are stable for a run, matrix runs bind one slot per parameter set.
+	mutable TArray<FParameterSlot, TInlineAllocator<1>> ParameterSlots;
+
+	/** Value, Object or DataTable source resolved for one target property type, kept until the next run. */
+	struct FSourceBinding
+	{
+		// Null for the Value source, it doesn't read any parameter.
+		const FInstancedPropertyBag* Parameters = nullptr;
+		const FFieldClass* SourceProperty = nullptr;
+		const FFieldClass* TargetProperty = nullptr;
+		const UStruct* SourceType = nullptr;
+
+		// The property the source was resolved to, null if it failed to resolve.
+		const FProperty* Property = nullptr;
+
+		// Unset if the source failed to resolve or didn't match, the warning is logged once when binding.
+		TOptional<const void*> Value;
+	};
+
+	/**
+	 * The source value for SourceProperty and SourceType, checked against TargetProperty if given. Property lookup,
+	 * path resolution and type checks run the first time each combination shows up during a run, later calls reuse the bound value pointer.
+	 */
+	const FSourceBinding& BindSource(
+		const FFieldClass* SourceProperty,
+		const FInstancedPropertyBag& InParameters,
+		const UStruct* SourceType,
+		const FFieldClass* TargetProperty = nullptr) const;
+
+	mutable TArray<FSourceBinding, TInlineAllocator<1>> SourceBindings;
+
+	TOptional<const void*> GetValueFromStructProperty(
+		const FFieldClass* SourceProperty,
+		const FProperty*& OutProperty,
+		const UStruct* SourceType = nullptr) const;
 
 	TOptional<const void*> GetValueFromObjectAsset(
 		const FFieldClass* SourceProperty,
 		const FInstancedPropertyBag& InParameters,
+		const FProperty*& OutProperty,
 		const UStruct* SourceType = nullptr) const;
 
 	TOptional<const void*> GetValueFromDataTable(
 		const FFieldClass* SourceProperty,
 		const FInstancedPropertyBag& InParameters,
+		const FProperty*& OutProperty,
 		const UStruct* SourceType = nullptr) const;
 
 	static bool IsCompatibleType(
@@ -154,6 +251,8 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void LowerGuards(FAruProgramBuilder& InBuilder) const override;
+
 protected:
 	virtual FString GetCompactName() const override { return {"SetBoolValue"}; }
 };
@@ -176,6 +275,15 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void LowerGuards(FAruProgramBuilder& InBuilder) const override;
+
+	virtual int32 ExecuteBatch(
+		const FProperty* InElementProperty,
+		void* InValues,
+		const int32 InNum,
+		const TBitArray<>& InMatches,
+		const FInstancedPropertyBag& InParameters) const override;
+
 protected:
 	virtual FString GetCompactName() const override { return {"SetFloatValue"}; }
 };
@@ -198,6 +306,15 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void LowerGuards(FAruProgramBuilder& InBuilder) const override;
+
+	virtual int32 ExecuteBatch(
+		const FProperty* InElementProperty,
+		void* InValues,
+		const int32 InNum,
+		const TBitArray<>& InMatches,
+		const FInstancedPropertyBag& InParameters) const override;
+
 protected:
 	virtual FString GetCompactName() const override { return {"SetIntegerValue"}; }
 };
@@ -286,8 +403,16 @@ public:
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
 
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
+
 protected:
 	virtual FString GetCompactName() const override { return {"SetEnumValue"}; }
+
+private:
+	/** Enums are searched once per enum and name, sources giving the same name every time never search again. */
+	int64 ResolveEnumValue(const UEnum* InEnum, const FString& InName) const;
+
+	mutable TArray<TTuple<const UEnum*, FString, int64>, TInlineAllocator<1>> ResolvedValues;
 };
 
 USTRUCT(BlueprintType, DisplayName="Set Struct Value")
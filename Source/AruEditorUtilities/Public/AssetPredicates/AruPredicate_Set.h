@@ -14,6 +14,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
@@ -34,6 +35,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))
@@ -54,6 +56,7 @@ public:
 		const FProperty* InProperty,
 		void* InValue,
 		const FInstancedPropertyBag& InParameters) const override;
+	virtual void BeginProcessing(const FInstancedPropertyBag& InParameters) const override;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, meta=(ExcludeBaseStruct))